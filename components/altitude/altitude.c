@@ -0,0 +1,313 @@
+/*
+Name : altitude.c
+
+Description :
+    This source file implements the altitude estimator, a three state Kalman
+    filter: altitude, climb rate and the bias of the barometric altitude. The
+    altitude follows a constant climb rate model driven by random vertical
+    acceleration, and the bias a random walk for weather and sensor offset.
+
+    GNSS altitude and vertical speed are scalar measurements weighted by the
+    accuracy reported with them; measurements further than GATE deviations
+    from the prediction (e.g. multipath) are rejected. Barometric altitude
+    measures altitude plus bias, so after a few fixes the barometer carries
+    the short-term altitude and climb rate and GNSS the long-term level. Every
+    update has a fixed cost of a few dozen multiplications.
+
+    The file has no Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "altitude.h"
+
+/* Innovations beyond this many standard deviations are rejected. */
+#define GATE 5.0f
+
+/* Barometric altitude noise in meters. */
+#define BARO_NOISE_M 0.3f
+
+/* Standard atmosphere, for the barometric altitude. */
+#define SEA_LEVEL_PA 101325.0f
+
+/* Initial uncertainty of the climb rate (m/s) and barometer bias (m). */
+#define INITIAL_CLIMB_STD 2.0f
+#define INITIAL_BIAS_STD 100.0f
+
+/* Updates further apart than this restart the filter. */
+#define MAX_GAP_MS (600 * 1000)
+
+/*
+Function : altitude_init
+
+Description :
+    Initializes a filter, which starts at the first GNSS altitude.
+
+Parameter :
+    struct altitude_filter *filter - Filter
+    float accel_noise              - Vertical acceleration noise in m/s^2
+    float bias_drift               - Barometer bias drift in m per sqrt(s)
+
+Return :
+    void
+
+Example Call :
+    altitude_init(&filter, 0.5f, 0.05f);
+*/
+void altitude_init(struct altitude_filter *filter, float accel_noise, float bias_drift)
+{
+    memset(filter, 0, sizeof(*filter));
+    filter->accel_noise = accel_noise;
+    filter->bias_drift = bias_drift;
+}
+
+/*
+Function : predict
+
+Description :
+    Propagates the state and covariance to the given time.
+
+Parameter :
+    struct altitude_filter *filter - Filter
+    int64_t time_ms                - Time of the next measurement
+
+Return :
+    void
+
+Example Call :
+    predict(filter, time_ms);
+*/
+static void predict(struct altitude_filter *filter, int64_t time_ms)
+{
+    float dt = (float)(time_ms - filter->time_ms) / 1000.0f;
+    float (*p)[3] = filter->p;
+
+    filter->time_ms = time_ms;
+    if (dt <= 0.0f)
+    {
+        return;
+    }
+
+    float q = filter->accel_noise * filter->accel_noise;
+    float dt2 = dt * dt;
+
+    filter->x[0] += filter->x[1] * dt;
+
+    /* P = F P F' + Q with F = [1 dt 0; 0 1 0; 0 0 1]. */
+    p[0][0] += dt * (p[0][1] + p[1][0]) + dt2 * p[1][1] + q * dt2 * dt2 / 4.0f;
+    p[0][1] += dt * p[1][1] + q * dt2 * dt / 2.0f;
+    p[1][0] = p[0][1];
+    p[0][2] += dt * p[1][2];
+    p[2][0] = p[0][2];
+    p[1][1] += q * dt2;
+    p[2][2] += filter->bias_drift * filter->bias_drift * dt;
+}
+
+/*
+Function : update
+
+Description :
+    Applies a scalar measurement z = h x + noise with variance r.
+
+Parameter :
+    struct altitude_filter *filter - Filter
+    const float h[3]               - Measurement row
+    float z                        - Measurement
+    float r                        - Measurement variance
+
+Return :
+    bool - false if the measurement was rejected by the gate
+
+Example Call :
+    update(filter, (const float[3]){1.0f, 0.0f, 0.0f}, altitude, var);
+*/
+static bool update(struct altitude_filter *filter, const float h[3], float z, float r)
+{
+    float (*p)[3] = filter->p;
+    float ph[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        ph[i] = p[i][0] * h[0] + p[i][1] * h[1] + p[i][2] * h[2];
+    }
+
+    float s = h[0] * ph[0] + h[1] * ph[1] + h[2] * ph[2] + r;
+    float y = z - (h[0] * filter->x[0] + h[1] * filter->x[1] + h[2] * filter->x[2]);
+
+    if (y * y > GATE * GATE * s)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        float k = ph[i] / s;
+
+        filter->x[i] += k * y;
+        for (int j = 0; j < 3; j++)
+        {
+            p[i][j] -= k * ph[j];
+        }
+    }
+
+    return true;
+}
+
+/*
+Function : altitude_update_gnss
+
+Description :
+    Updates the filter with a GNSS fix. The first fix, or one after a long
+    gap, (re)starts the filter at its altitude.
+
+Parameter :
+    struct altitude_filter *filter - Filter
+    int64_t time_ms                - Time of the fix in milliseconds
+    float altitude                 - Altitude above the ellipsoid in meters
+    float altitude_accuracy        - Altitude accuracy (1 sigma) in meters
+    float vertical_speed           - Vertical speed in m/s, up positive
+    float vertical_speed_accuracy  - Vertical speed accuracy in m/s, 0 if unknown
+
+Return :
+    void
+
+Example Call :
+    altitude_update_gnss(&filter, now, pvt->altitude, pvt->altitude_accuracy,
+                         pvt->vertical_speed, pvt->vertical_speed_accuracy);
+*/
+void altitude_update_gnss(struct altitude_filter *filter, int64_t time_ms, float altitude,
+                          float altitude_accuracy, float vertical_speed,
+                          float vertical_speed_accuracy)
+{
+    float alt_var = altitude_accuracy * altitude_accuracy;
+
+    if (!filter->initialized || time_ms - filter->time_ms > MAX_GAP_MS)
+    {
+        memset(filter->p, 0, sizeof(filter->p));
+        filter->x[0] = altitude;
+        filter->x[1] = 0.0f;
+        filter->x[2] = 0.0f;
+        filter->p[0][0] = alt_var;
+        filter->p[1][1] = INITIAL_CLIMB_STD * INITIAL_CLIMB_STD;
+        filter->p[2][2] = INITIAL_BIAS_STD * INITIAL_BIAS_STD;
+        filter->time_ms = time_ms;
+        filter->initialized = true;
+        filter->baro_initialized = false;
+    }
+    else
+    {
+        predict(filter, time_ms);
+        update(filter, (const float[3]){1.0f, 0.0f, 0.0f}, altitude, alt_var);
+    }
+
+    if (vertical_speed_accuracy > 0.0f)
+    {
+        update(filter, (const float[3]){0.0f, 1.0f, 0.0f}, vertical_speed,
+               vertical_speed_accuracy * vertical_speed_accuracy);
+    }
+}
+
+/*
+Function : altitude_update_baro
+
+Description :
+    Updates the filter with a barometric pressure reading. Ignored until the
+    first GNSS fix, as the barometer only measures altitude changes.
+
+Parameter :
+    struct altitude_filter *filter - Filter
+    int64_t time_ms                - Time of the reading in milliseconds
+    float pressure_pa              - Pressure in pascals
+
+Return :
+    void
+
+Example Call :
+    altitude_update_baro(&filter, now, pressure);
+*/
+void altitude_update_baro(struct altitude_filter *filter, int64_t time_ms, float pressure_pa)
+{
+    if (!filter->initialized || time_ms - filter->time_ms > MAX_GAP_MS)
+    {
+        return;
+    }
+
+    float baro_altitude = altitude_from_pressure(pressure_pa);
+
+    /* Start the bias at the first reading, the prior only bounds it. */
+    if (!filter->baro_initialized)
+    {
+        filter->x[2] = baro_altitude - filter->x[0];
+        filter->baro_initialized = true;
+    }
+
+    predict(filter, time_ms);
+    update(filter, (const float[3]){1.0f, 0.0f, 1.0f}, baro_altitude,
+           BARO_NOISE_M * BARO_NOISE_M);
+}
+
+/*
+Function : altitude_from_pressure
+
+Description :
+    Converts pressure to altitude in the standard atmosphere.
+
+Parameter :
+    float pressure_pa - Pressure in pascals
+
+Return :
+    float - Barometric altitude in meters
+
+Example Call :
+    float h = altitude_from_pressure(95000.0f);
+*/
+float altitude_from_pressure(float pressure_pa)
+{
+    return 44330.0f * (1.0f - powf(pressure_pa / SEA_LEVEL_PA, 1.0f / 5.255f));
+}
+
+/*
+Function : altitude_get
+
+Description :
+    Returns the filtered altitude.
+
+Parameter :
+    const struct altitude_filter *filter - Filter
+
+Return :
+    float - Altitude in meters, NAN before the first fix
+
+Example Call :
+    float altitude = altitude_get(&filter);
+*/
+float altitude_get(const struct altitude_filter *filter)
+{
+    return filter->initialized ? filter->x[0] : NAN;
+}
+
+/*
+Function : altitude_climb_rate_get
+
+Description :
+    Returns the filtered climb rate.
+
+Parameter :
+    const struct altitude_filter *filter - Filter
+
+Return :
+    float - Climb rate in m/s, up positive, NAN before the first fix
+
+Example Call :
+    float climb = altitude_climb_rate_get(&filter);
+*/
+float altitude_climb_rate_get(const struct altitude_filter *filter)
+{
+    return filter->initialized ? filter->x[1] : NAN;
+}
@@ -0,0 +1,50 @@
+/*
+Name : altitude.h
+
+Description :
+    Header file for the altitude estimator. Declares a Kalman filter over
+    altitude, climb rate and barometer bias that fuses GNSS altitude and
+    vertical speed, weighted by their accuracy, with optional barometric
+    pressure.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _ALTITUDE_H
+#define _ALTITUDE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct altitude_filter
+{
+    bool initialized;
+    bool baro_initialized;
+    int64_t time_ms;
+
+    /* Altitude (m), climb rate (m/s), barometric altitude bias (m). */
+    float x[3];
+    float p[3][3];
+
+    /* Process noise: vertical acceleration (m/s^2), bias drift (m/sqrt(s)). */
+    float accel_noise;
+    float bias_drift;
+};
+
+void altitude_init(struct altitude_filter *filter, float accel_noise, float bias_drift);
+
+void altitude_update_gnss(struct altitude_filter *filter, int64_t time_ms, float altitude,
+                          float altitude_accuracy, float vertical_speed,
+                          float vertical_speed_accuracy);
+
+void altitude_update_baro(struct altitude_filter *filter, int64_t time_ms, float pressure_pa);
+
+float altitude_from_pressure(float pressure_pa);
+
+float altitude_get(const struct altitude_filter *filter);
+
+float altitude_climb_rate_get(const struct altitude_filter *filter);
+
+#endif
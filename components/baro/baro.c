@@ -0,0 +1,146 @@
+/*
+Name : baro.c
+
+Description :
+    This source file implements the barometer abstraction used by the altitude
+    filter. With CONFIG_GNSS_SAMPLE_BARO_SENSOR the pressure is read from the
+    sensor behind the pressure-sensor devicetree alias. With
+    CONFIG_GNSS_SAMPLE_BARO_SIM it is simulated for a device resting at
+    CONFIG_GNSS_SAMPLE_BARO_SIM_ALTITUDE, with sensor noise and a slow weather
+    change, so the fusion can be exercised without hardware. Without either,
+    no pressure is available.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <errno.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#if defined(CONFIG_GNSS_SAMPLE_BARO_SENSOR)
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#endif
+#include "baro.h"
+
+LOG_MODULE_REGISTER(BARO);
+
+#if defined(CONFIG_GNSS_SAMPLE_BARO_SENSOR)
+static const struct device *const sensor = DEVICE_DT_GET(DT_ALIAS(pressure_sensor));
+#endif
+
+#if defined(CONFIG_GNSS_SAMPLE_BARO_SIM)
+/* Noise amplitude, and amplitude and period of the weather change. */
+#define SIM_NOISE_PA 4.0f
+#define SIM_WEATHER_PA 150.0f
+#define SIM_WEATHER_PERIOD_S (12.0f * 3600.0f)
+
+static uint32_t sim_seed = 1;
+
+/*
+Function : sim_noise
+
+Description :
+    Returns uniform noise from a xorshift generator.
+
+Parameter :
+    void
+
+Return :
+    float - Noise in [-1, 1)
+
+Example Call :
+    float n = sim_noise();
+*/
+static float sim_noise(void)
+{
+    sim_seed ^= sim_seed << 13;
+    sim_seed ^= sim_seed >> 17;
+    sim_seed ^= sim_seed << 5;
+
+    return (float)sim_seed / 2147483648.0f - 1.0f;
+}
+#endif
+
+/*
+Function : baro_init
+
+Description :
+    Checks that the configured pressure source is available.
+
+Parameter :
+    void
+
+Return :
+    int - 0 on success, -ENODEV if no pressure source is available
+
+Example Call :
+    baro_init();
+*/
+int baro_init(void)
+{
+#if defined(CONFIG_GNSS_SAMPLE_BARO_SENSOR)
+    if (!device_is_ready(sensor))
+    {
+        LOG_ERR("Pressure sensor %s not ready", sensor->name);
+        return -ENODEV;
+    }
+    return 0;
+#elif defined(CONFIG_GNSS_SAMPLE_BARO_SIM)
+    LOG_INF("Simulated barometer at %d m", CONFIG_GNSS_SAMPLE_BARO_SIM_ALTITUDE);
+    return 0;
+#else
+    return -ENODEV;
+#endif
+}
+
+/*
+Function : baro_read
+
+Description :
+    Reads the current pressure.
+
+Parameter :
+    float *pressure_pa - Pressure output in pascals
+
+Return :
+    int - 0 on success, negative error code on failure
+
+Example Call :
+    if (baro_read(&pressure) == 0) { ... }
+*/
+int baro_read(float *pressure_pa)
+{
+#if defined(CONFIG_GNSS_SAMPLE_BARO_SENSOR)
+    struct sensor_value value;
+    int err = sensor_sample_fetch_chan(sensor, SENSOR_CHAN_PRESS);
+
+    if (err == 0)
+    {
+        err = sensor_channel_get(sensor, SENSOR_CHAN_PRESS, &value);
+    }
+
+    if (err != 0)
+    {
+        LOG_WRN("Failed to read pressure, error: %d", err);
+        return err;
+    }
+
+    /* Zephyr reports pressure in kPa. */
+    *pressure_pa = (float)sensor_value_to_double(&value) * 1000.0f;
+    return 0;
+#elif defined(CONFIG_GNSS_SAMPLE_BARO_SIM)
+    float t = (float)k_uptime_get() / 1000.0f;
+    float altitude = (float)CONFIG_GNSS_SAMPLE_BARO_SIM_ALTITUDE;
+
+    *pressure_pa = 101325.0f * powf(1.0f - altitude / 44330.0f, 5.255f) +
+                   SIM_WEATHER_PA * sinf(2.0f * 3.14159265f * t / SIM_WEATHER_PERIOD_S) +
+                   SIM_NOISE_PA * sim_noise();
+    return 0;
+#else
+    ARG_UNUSED(pressure_pa);
+    return -ENODEV;
+#endif
+}
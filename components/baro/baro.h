@@ -0,0 +1,20 @@
+/*
+Name : baro.h
+
+Description :
+    Header file for the barometer abstraction. Declares a pressure source that
+    is either a Zephyr pressure sensor or a simulated barometer.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _BARO_H
+#define _BARO_H
+
+int baro_init(void);
+
+int baro_read(float *pressure_pa);
+
+#endif
@@ -0,0 +1,248 @@
+/*
+Name : energy.c
+
+Description :
+    This source file implements the energy accounting model. Every component
+    accumulates its active time, and its charge is the active time multiplied
+    by the current it draws over the sleep floor; the floor itself is charged
+    over all elapsed time. Dividing the total by the number of delivered fixes
+    gives the energy per fix, the figure policies are compared on.
+
+    Charge is in mA·s (multiply by the supply voltage for joules). The file has
+    no Zephyr dependencies so the replay tools can account the same way as the
+    target.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "energy.h"
+
+/* Start, stop and data bits of one UART frame. */
+#define UART_BITS_PER_BYTE 10
+
+const struct energy_model energy_model_nrf91 = {
+    .current_ua = {
+        [ENERGY_GNSS] = 44000,
+        [ENERGY_LTE_TX] = 100000,
+        [ENERGY_LTE_RX] = 10000,
+        [ENERGY_CPU] = 2500,
+        [ENERGY_UART] = 700,
+        [ENERGY_IDLE] = 3,
+    },
+    .uart_baudrate = 115200,
+};
+
+static const char *const component_names[ENERGY_COMPONENTS] = {
+    [ENERGY_GNSS] = "gnss",
+    [ENERGY_LTE_TX] = "lte_tx",
+    [ENERGY_LTE_RX] = "lte_rx",
+    [ENERGY_CPU] = "cpu",
+    [ENERGY_UART] = "uart",
+    [ENERGY_IDLE] = "idle",
+};
+
+/*
+Function : energy_init
+
+Description :
+    Initializes an empty account with a current model.
+
+Parameter :
+    struct energy_account *account   - Account
+    const struct energy_model *model - Currents, e.g. &energy_model_nrf91
+
+Return :
+    void
+
+Example Call :
+    energy_init(&account, &energy_model_nrf91);
+*/
+void energy_init(struct energy_account *account, const struct energy_model *model)
+{
+    memset(account, 0, sizeof(*account));
+    account->model = *model;
+}
+
+/*
+Function : energy_add_us
+
+Description :
+    Adds active time to a component. For ENERGY_IDLE the elapsed time is
+    added instead.
+
+Parameter :
+    struct energy_account *account    - Account
+    enum energy_component component   - Component
+    uint64_t active_us                - Active time in microseconds
+
+Return :
+    void
+
+Example Call :
+    energy_add_us(&account, ENERGY_GNSS, on_ms * 1000);
+*/
+void energy_add_us(struct energy_account *account, enum energy_component component,
+                   uint64_t active_us)
+{
+    if (component >= ENERGY_COMPONENTS)
+    {
+        return;
+    }
+
+    account->active_us[component] += active_us;
+}
+
+/*
+Function : energy_add_uart_bytes
+
+Description :
+    Adds the time the UART is busy sending the given number of bytes.
+
+Parameter :
+    struct energy_account *account - Account
+    uint32_t bytes                 - Bytes written to the UART
+
+Return :
+    void
+
+Example Call :
+    energy_add_uart_bytes(&account, 512);
+*/
+void energy_add_uart_bytes(struct energy_account *account, uint32_t bytes)
+{
+    if (account->model.uart_baudrate == 0)
+    {
+        return;
+    }
+
+    account->active_us[ENERGY_UART] +=
+        (uint64_t)bytes * UART_BITS_PER_BYTE * 1000000 / account->model.uart_baudrate;
+}
+
+/*
+Function : energy_fix_delivered
+
+Description :
+    Counts a fix delivered to the application.
+
+Parameter :
+    struct energy_account *account - Account
+
+Return :
+    void
+
+Example Call :
+    energy_fix_delivered(&account);
+*/
+void energy_fix_delivered(struct energy_account *account)
+{
+    account->fixes++;
+}
+
+/*
+Function : energy_charge_mas
+
+Description :
+    Returns the charge of a component.
+
+Parameter :
+    const struct energy_account *account - Account
+    enum energy_component component      - Component
+
+Return :
+    double - Charge in mA·s
+
+Example Call :
+    double gnss = energy_charge_mas(&account, ENERGY_GNSS);
+*/
+double energy_charge_mas(const struct energy_account *account, enum energy_component component)
+{
+    if (component >= ENERGY_COMPONENTS)
+    {
+        return 0.0;
+    }
+
+    /* uA x us = 1e-9 mA·s */
+    return (double)account->active_us[component] * account->model.current_ua[component] / 1e9;
+}
+
+/*
+Function : energy_total_mas
+
+Description :
+    Returns the charge of all components.
+
+Parameter :
+    const struct energy_account *account - Account
+
+Return :
+    double - Charge in mA·s
+
+Example Call :
+    double total = energy_total_mas(&account);
+*/
+double energy_total_mas(const struct energy_account *account)
+{
+    double total = 0.0;
+
+    for (int i = 0; i < ENERGY_COMPONENTS; i++)
+    {
+        total += energy_charge_mas(account, (enum energy_component)i);
+    }
+
+    return total;
+}
+
+/*
+Function : energy_per_fix_mas
+
+Description :
+    Returns the charge per delivered fix.
+
+Parameter :
+    const struct energy_account *account - Account
+
+Return :
+    double - Charge in mA·s per fix, 0 if no fix was delivered
+
+Example Call :
+    double per_fix = energy_per_fix_mas(&account);
+*/
+double energy_per_fix_mas(const struct energy_account *account)
+{
+    if (account->fixes == 0)
+    {
+        return 0.0;
+    }
+
+    return energy_total_mas(account) / account->fixes;
+}
+
+/*
+Function : energy_component_name
+
+Description :
+    Returns the name of a component for reports.
+
+Parameter :
+    enum energy_component component - Component
+
+Return :
+    const char * - Name, "unknown" for an invalid component
+
+Example Call :
+    const char *name = energy_component_name(ENERGY_GNSS);
+*/
+const char *energy_component_name(enum energy_component component)
+{
+    if (component >= ENERGY_COMPONENTS)
+    {
+        return "unknown";
+    }
+
+    return component_names[component];
+}
@@ -0,0 +1,65 @@
+/*
+Name : energy.h
+
+Description :
+    Header file for the energy accounting model. Declares the components whose
+    charge is estimated from their active time and a per-component current,
+    and the account that turns them into mA·s and mA·s per delivered fix.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _ENERGY_H
+#define _ENERGY_H
+
+#include <stdint.h>
+
+enum energy_component
+{
+    ENERGY_GNSS,    /* GNSS receiver on */
+    ENERGY_LTE_TX,  /* LTE transmitting */
+    ENERGY_LTE_RX,  /* LTE RRC connected */
+    ENERGY_CPU,     /* Application core active */
+    ENERGY_UART,    /* UART output */
+    ENERGY_IDLE,    /* Sleep floor, charged over all elapsed time */
+
+    ENERGY_COMPONENTS
+};
+
+/* Current of each component while active, over the sleep floor. */
+struct energy_model
+{
+    uint32_t current_ua[ENERGY_COMPONENTS];
+    uint32_t uart_baudrate;
+};
+
+struct energy_account
+{
+    struct energy_model model;
+    uint64_t active_us[ENERGY_COMPONENTS];
+    uint32_t fixes;
+};
+
+/* Typical nRF91 currents at 3.7 V. */
+extern const struct energy_model energy_model_nrf91;
+
+void energy_init(struct energy_account *account, const struct energy_model *model);
+
+void energy_add_us(struct energy_account *account, enum energy_component component,
+                   uint64_t active_us);
+
+void energy_add_uart_bytes(struct energy_account *account, uint32_t bytes);
+
+void energy_fix_delivered(struct energy_account *account);
+
+double energy_charge_mas(const struct energy_account *account, enum energy_component component);
+
+double energy_total_mas(const struct energy_account *account);
+
+double energy_per_fix_mas(const struct energy_account *account);
+
+const char *energy_component_name(enum energy_component component);
+
+#endif
@@ -0,0 +1,358 @@
+/*
+Name : energy_monitor.c
+
+Description :
+    This source file feeds the energy account on target. GNSS on and off
+    times are reported by the GNSS loop, LTE transmit time by an uplink, RRC connected
+    time comes from link controller events, CPU active time from the kernel's
+    idle thread statistics, UART output from the log output byte count and
+    delivered fixes from gnss_fix_chan. The charge of every component and the
+    charge per delivered fix are logged every
+    CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL seconds.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+#include <modem/lte_lc.h>
+#include "energy.h"
+#include "energy_monitor.h"
+#include "gnss_bus.h"
+#include "log_stats.h"
+
+LOG_MODULE_REGISTER(ENERGY);
+
+#define CONSOLE_BAUDRATE DT_PROP_OR(DT_CHOSEN(zephyr_console), current_speed, 115200)
+
+static const struct energy_model model = {
+    .current_ua = {
+        [ENERGY_GNSS] = CONFIG_GNSS_SAMPLE_ENERGY_GNSS_CURRENT,
+        [ENERGY_LTE_TX] = CONFIG_GNSS_SAMPLE_ENERGY_LTE_TX_CURRENT,
+        [ENERGY_LTE_RX] = CONFIG_GNSS_SAMPLE_ENERGY_LTE_RX_CURRENT,
+        [ENERGY_CPU] = CONFIG_GNSS_SAMPLE_ENERGY_CPU_CURRENT,
+        [ENERGY_UART] = CONFIG_GNSS_SAMPLE_ENERGY_UART_CURRENT,
+        [ENERGY_IDLE] = CONFIG_GNSS_SAMPLE_ENERGY_IDLE_CURRENT,
+    },
+    .uart_baudrate = CONSOLE_BAUDRATE,
+};
+
+static struct energy_account account;
+static struct k_spinlock lock;
+
+/* Where the sampled sources were last read. */
+static int64_t sampled_uptime;
+static uint64_t sampled_cpu_cycles;
+
+/* Uptime when RRC connected, 0 while idle. */
+static int64_t rrc_connected_since;
+
+/* Uptime when GNSS turned on, 0 while off. */
+static int64_t gnss_on_since;
+
+static void report_work_fn(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(report_work, report_work_fn);
+
+/*
+Function : fix_listener_cb
+
+Description :
+    Counts a delivered fix for every message published on gnss_fix_chan.
+
+Parameter :
+    const struct zbus_channel *chan - Channel that was published
+
+Return :
+    void
+
+Example Call :
+    Called by zbus.
+*/
+static void fix_listener_cb(const struct zbus_channel *chan)
+{
+    ARG_UNUSED(chan);
+
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    energy_fix_delivered(&account);
+    k_spin_unlock(&lock, key);
+}
+
+ZBUS_LISTENER_DEFINE(energy_fix_lis, fix_listener_cb);
+ZBUS_CHAN_ADD_OBS(gnss_fix_chan, energy_fix_lis, 3);
+
+/*
+Function : rrc_connected_take
+
+Description :
+    Adds the RRC connected time since the last call to the account. Must be
+    called with the lock held.
+
+Parameter :
+    int64_t now - Current uptime in milliseconds
+
+Return :
+    void
+
+Example Call :
+    rrc_connected_take(k_uptime_get());
+*/
+static void rrc_connected_take(int64_t now)
+{
+    if (rrc_connected_since != 0)
+    {
+        energy_add_us(&account, ENERGY_LTE_RX, (uint64_t)(now - rrc_connected_since) * 1000);
+        rrc_connected_since = now;
+    }
+}
+
+/*
+Function : gnss_on_take
+
+Description :
+    Adds the GNSS on-time since the last call to the account. Must be called
+    with the lock held.
+
+Parameter :
+    int64_t now - Current uptime in milliseconds
+
+Return :
+    void
+
+Example Call :
+    gnss_on_take(k_uptime_get());
+*/
+static void gnss_on_take(int64_t now)
+{
+    /* The GNSS loop may report turning off at an uptime already sampled. */
+    if (gnss_on_since != 0 && now > gnss_on_since)
+    {
+        energy_add_us(&account, ENERGY_GNSS, (uint64_t)(now - gnss_on_since) * 1000);
+        gnss_on_since = now;
+    }
+}
+
+/*
+Function : lte_event_handler
+
+Description :
+    Tracks the RRC connected time from link controller events.
+
+Parameter :
+    const struct lte_lc_evt *const evt - Link controller event
+
+Return :
+    void
+
+Example Call :
+    Called by the LTE link controller.
+*/
+static void lte_event_handler(const struct lte_lc_evt *const evt)
+{
+    if (evt->type != LTE_LC_EVT_RRC_UPDATE)
+    {
+        return;
+    }
+
+    int64_t now = k_uptime_get();
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    rrc_connected_take(now);
+    rrc_connected_since = evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED ? now : 0;
+    k_spin_unlock(&lock, key);
+}
+
+/*
+Function : sources_sample
+
+Description :
+    Adds the time elapsed, CPU active time, UART output and the RRC connected
+    and GNSS on-time of the open periods since the previous sample to the
+    account. Must be called with the lock held.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    sources_sample();
+*/
+static void sources_sample(void)
+{
+    int64_t now = k_uptime_get();
+    k_thread_runtime_stats_t stats;
+
+    energy_add_us(&account, ENERGY_IDLE, (uint64_t)(now - sampled_uptime) * 1000);
+    sampled_uptime = now;
+
+    /* Cycles not spent in the idle thread. */
+    if (k_thread_runtime_stats_all_get(&stats) == 0)
+    {
+        energy_add_us(&account, ENERGY_CPU,
+                      k_cyc_to_us_floor64(stats.total_cycles - sampled_cpu_cycles));
+        sampled_cpu_cycles = stats.total_cycles;
+    }
+
+    energy_add_uart_bytes(&account, log_stats_output_take());
+    rrc_connected_take(now);
+    gnss_on_take(now);
+}
+
+/*
+Function : energy_monitor_gnss_on
+
+Description :
+    Starts a GNSS on-time period. Its on-time is added to the account when it
+    ends and at every report while it lasts.
+
+Parameter :
+    int64_t now - Uptime in milliseconds when GNSS turned on
+
+Return :
+    void
+
+Example Call :
+    energy_monitor_gnss_on(on_since);
+*/
+void energy_monitor_gnss_on(int64_t now)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    gnss_on_take(now);
+    gnss_on_since = now;
+    k_spin_unlock(&lock, key);
+}
+
+/*
+Function : energy_monitor_gnss_off
+
+Description :
+    Ends the GNSS on-time period and adds its remaining on-time to the
+    account.
+
+Parameter :
+    int64_t now - Uptime in milliseconds when GNSS stopped or went to sleep
+
+Return :
+    void
+
+Example Call :
+    energy_monitor_gnss_off(now);
+*/
+void energy_monitor_gnss_off(int64_t now)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    gnss_on_take(now);
+    gnss_on_since = 0;
+    k_spin_unlock(&lock, key);
+}
+
+/*
+Function : energy_monitor_lte_tx
+
+Description :
+    Adds LTE transmit time to the account, to be called by an uplink for
+    every transmission.
+
+Parameter :
+    uint32_t tx_ms - Transmit time in milliseconds
+
+Return :
+    void
+
+Example Call :
+    energy_monitor_lte_tx(tx_ms);
+*/
+void energy_monitor_lte_tx(uint32_t tx_ms)
+{
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    energy_add_us(&account, ENERGY_LTE_TX, (uint64_t)tx_ms * 1000);
+    k_spin_unlock(&lock, key);
+}
+
+/*
+Function : energy_monitor_report
+
+Description :
+    Logs the charge of every component since boot, the total and the charge
+    per delivered fix.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    energy_monitor_report();
+*/
+void energy_monitor_report(void)
+{
+    struct energy_account snapshot;
+    k_spinlock_key_t key = k_spin_lock(&lock);
+
+    sources_sample();
+    snapshot = account;
+    k_spin_unlock(&lock, key);
+
+    for (int i = 0; i < ENERGY_COMPONENTS; i++)
+    {
+        LOG_INF("Energy %s: %.03f mAs", energy_component_name(i),
+                energy_charge_mas(&snapshot, i));
+    }
+
+    LOG_INF("Energy total: %.03f mAs, %u fixes, %.03f mAs per fix",
+            energy_total_mas(&snapshot), snapshot.fixes, energy_per_fix_mas(&snapshot));
+}
+
+static void report_work_fn(struct k_work *work)
+{
+    energy_monitor_report();
+    k_work_reschedule(k_work_delayable_from_work(work),
+                      K_SECONDS(CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL));
+}
+
+/*
+Function : energy_monitor_init
+
+Description :
+    Starts accounting from the current uptime, registers for RRC events and
+    starts the periodic report, unless the report interval is zero.
+
+Parameter :
+    void
+
+Return :
+    int - Always returns 0
+
+Example Call :
+    energy_monitor_init();
+*/
+int energy_monitor_init(void)
+{
+    k_thread_runtime_stats_t stats;
+
+    energy_init(&account, &model);
+    sampled_uptime = k_uptime_get();
+    if (k_thread_runtime_stats_all_get(&stats) == 0)
+    {
+        sampled_cpu_cycles = stats.total_cycles;
+    }
+
+    lte_lc_register_handler(lte_event_handler);
+
+    if (CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL > 0)
+    {
+        k_work_schedule(&report_work, K_SECONDS(CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL));
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*
+Name : energy_monitor.h
+
+Description :
+    Header file for the on-target energy monitor. Declares the hooks the GNSS
+    loop and an uplink use to report the active time of their components, and
+    the periodic energy report.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _ENERGY_MONITOR_H
+#define _ENERGY_MONITOR_H
+
+#include <stdint.h>
+
+#if defined(CONFIG_GNSS_SAMPLE_ENERGY)
+int energy_monitor_init(void);
+
+void energy_monitor_gnss_on(int64_t now);
+
+void energy_monitor_gnss_off(int64_t now);
+
+void energy_monitor_lte_tx(uint32_t tx_ms);
+
+void energy_monitor_report(void);
+#else
+static inline int energy_monitor_init(void)
+{
+    return 0;
+}
+
+static inline void energy_monitor_gnss_on(int64_t now)
+{
+}
+
+static inline void energy_monitor_gnss_off(int64_t now)
+{
+}
+
+static inline void energy_monitor_lte_tx(uint32_t tx_ms)
+{
+}
+
+static inline void energy_monitor_report(void)
+{
+}
+#endif
+
+#endif
@@ -0,0 +1,187 @@
+/*
+Name : ephemeris.c
+
+Description :
+    This source file implements ephemeris age tracking from the satellites used
+    in fixes. The modem does not report when it decoded an ephemeris, so the
+    tracker infers it: a satellite used in a fix after its previous ephemeris
+    expired (or for the first time) must have a freshly decoded one, as does a
+    satellite used right after a scheduled download. The broadcast ephemeris is
+    renewed every 2 hours and usable for about 4, so a decoded ephemeris is
+    assumed usable for validity_s seconds (2 hours by default) and is not
+    extended by later fixes using it.
+
+    When fewer than the required satellites hold a usable ephemeris, the next
+    fix has to decode the broadcast again and takes a cold start time instead
+    of a few seconds. The file has no Zephyr dependencies so it can be used by
+    the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "ephemeris.h"
+#include "sv_table.h"
+
+/*
+Function : ephemeris_init
+
+Description :
+    Initializes a tracker with no usable ephemerides.
+
+Parameter :
+    struct ephemeris_tracker *tracker - Tracker
+    uint32_t validity_s               - Lifetime of a decoded ephemeris in seconds
+
+Return :
+    void
+
+Example Call :
+    ephemeris_init(&tracker, 2 * 3600);
+*/
+void ephemeris_init(struct ephemeris_tracker *tracker, uint32_t validity_s)
+{
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->validity_s = validity_s;
+}
+
+/*
+Function : ephemeris_sv_index
+
+Description :
+    Maps a satellite to its index in the tracker, its compact index in the
+    satellite table.
+
+Parameter :
+    uint16_t sv    - Satellite PRN
+    uint8_t signal - Signal type the modem reports for the satellite
+
+Return :
+    int - Index, -1 if the satellite is not tracked
+
+Example Call :
+    int i = ephemeris_sv_index(pvt->sv[n].sv, pvt->sv[n].signal);
+*/
+int ephemeris_sv_index(uint16_t sv, uint8_t signal)
+{
+    uint8_t i = sv_table_index(sv, signal);
+
+    return i < EPHEMERIS_SV_COUNT ? i : -1;
+}
+
+/*
+Function : ephemeris_sv_used
+
+Description :
+    Records a satellite used in a fix. Its ephemeris is taken as freshly
+    decoded if the previous one had expired or if decoded is set.
+
+Parameter :
+    struct ephemeris_tracker *tracker - Tracker
+    uint16_t sv                       - Satellite PRN
+    uint8_t signal                    - Signal type the modem reports for it
+    uint32_t now_s                    - Current time in seconds
+    bool decoded                      - Ephemeris known to be freshly decoded
+
+Return :
+    void
+
+Example Call :
+    ephemeris_sv_used(&tracker, pvt->sv[n].sv, pvt->sv[n].signal, now_s, false);
+*/
+void ephemeris_sv_used(struct ephemeris_tracker *tracker, uint16_t sv, uint8_t signal,
+                       uint32_t now_s, bool decoded)
+{
+    int i = ephemeris_sv_index(sv, signal);
+
+    if (i < 0)
+    {
+        return;
+    }
+
+    if (decoded || tracker->valid_until[i] <= now_s)
+    {
+        tracker->valid_until[i] = now_s + tracker->validity_s;
+    }
+}
+
+/*
+Function : ephemeris_valid_count
+
+Description :
+    Counts the satellites that hold a usable ephemeris at a given time.
+
+Parameter :
+    const struct ephemeris_tracker *tracker - Tracker
+    uint32_t at_s                           - Time in seconds
+
+Return :
+    uint8_t - Number of satellites
+
+Example Call :
+    uint8_t n = ephemeris_valid_count(&tracker, now_s + interval_s);
+*/
+uint8_t ephemeris_valid_count(const struct ephemeris_tracker *tracker, uint32_t at_s)
+{
+    uint8_t count = 0;
+
+    for (int i = 0; i < EPHEMERIS_SV_COUNT; i++)
+    {
+        count += tracker->valid_until[i] > at_s;
+    }
+
+    return count;
+}
+
+/*
+Function : ephemeris_expiry
+
+Description :
+    Predicts when fewer than min_sv satellites will hold a usable ephemeris,
+    i.e. when the next fix becomes a cold start. This is the min_sv-th latest
+    expiry time.
+
+Parameter :
+    const struct ephemeris_tracker *tracker - Tracker
+    uint8_t min_sv                          - Satellites needed for a hot start
+
+Return :
+    uint32_t - Time in seconds, 0 if fewer than min_sv are usable already
+
+Example Call :
+    if (ephemeris_expiry(&tracker, 5) < next_fix_s) { ... }
+*/
+uint32_t ephemeris_expiry(const struct ephemeris_tracker *tracker, uint8_t min_sv)
+{
+    /* Latest min_sv expiry times, in descending order. */
+    uint32_t latest[EPHEMERIS_SV_COUNT] = {0};
+
+    if (min_sv == 0 || min_sv > EPHEMERIS_SV_COUNT)
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < EPHEMERIS_SV_COUNT; i++)
+    {
+        uint32_t t = tracker->valid_until[i];
+        int j = min_sv - 1;
+
+        if (t <= latest[j])
+        {
+            continue;
+        }
+
+        while (j > 0 && latest[j - 1] < t)
+        {
+            latest[j] = latest[j - 1];
+            j--;
+        }
+        latest[j] = t;
+    }
+
+    return latest[min_sv - 1];
+}
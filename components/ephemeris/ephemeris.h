@@ -0,0 +1,44 @@
+/*
+Name : ephemeris.h
+
+Description :
+    Header file for ephemeris age tracking. Declares a per-satellite tracker
+    estimating until when the receiver holds a usable ephemeris for each GPS
+    and QZSS satellite, and the queries predicting when the next fix will have
+    to decode ephemerides again (a cold start).
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _EPHEMERIS_H
+#define _EPHEMERIS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sv_table.h"
+
+/* GPS PRN 1-32 and QZSS PRN 193-202. */
+#define EPHEMERIS_SV_COUNT SV_TABLE_SV_COUNT
+
+struct ephemeris_tracker
+{
+    /* Conservative ephemeris lifetime after it was decoded, seconds. */
+    uint32_t validity_s;
+    /* Time until which the ephemeris is usable, seconds, 0 if unknown. */
+    uint32_t valid_until[EPHEMERIS_SV_COUNT];
+};
+
+void ephemeris_init(struct ephemeris_tracker *tracker, uint32_t validity_s);
+
+int ephemeris_sv_index(uint16_t sv, uint8_t signal);
+
+void ephemeris_sv_used(struct ephemeris_tracker *tracker, uint16_t sv, uint8_t signal,
+                       uint32_t now_s, bool decoded);
+
+uint8_t ephemeris_valid_count(const struct ephemeris_tracker *tracker, uint32_t at_s);
+
+uint32_t ephemeris_expiry(const struct ephemeris_tracker *tracker, uint8_t min_sv);
+
+#endif
@@ -0,0 +1,102 @@
+/*
+Name : event_report.c
+
+Description :
+    This source file implements the rate-limited event reporter. Each reporter
+    tracks one condition evaluated once per epoch: the start of the condition is
+    logged once, while it persists the number of epochs is logged at most every
+    CONFIG_GNSS_SAMPLE_EVENT_REPORT_INTERVAL seconds, and the end is logged with
+    the time elapsed since the start and the number of epochs. Occurrences and
+    affected epochs are counted in metrics.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include "event_report.h"
+#include "metrics.h"
+
+LOG_MODULE_REGISTER(EVENT_REPORT);
+
+#define REPORT_INTERVAL_MS (CONFIG_GNSS_SAMPLE_EVENT_REPORT_INTERVAL * MSEC_PER_SEC)
+
+/*
+Function : event_report_update
+
+Description :
+    Updates a reporter with the state of its condition in the current epoch and
+    logs the transition or the periodic count when due.
+
+Parameter :
+    struct event_report *report - Reporter
+    bool active                 - true if the condition is present in this epoch
+    int64_t now                 - Current uptime in milliseconds
+
+Return :
+    void
+
+Example Call :
+    event_report_update(&lte_blocked, pvt->flags & NRF_MODEM_GNSS_PVT_FLAG_DEADLINE_MISSED,
+                        k_uptime_get());
+*/
+void event_report_update(struct event_report *report, bool active, int64_t now)
+{
+    if (!active)
+    {
+        if (report->active)
+        {
+            uint32_t elapsed_ms = (uint32_t)(now - report->started);
+
+            LOG_INF("%s cleared after %u.%03u s (%u epochs)", report->name,
+                    elapsed_ms / MSEC_PER_SEC, elapsed_ms % MSEC_PER_SEC, report->epochs);
+            report->active = false;
+        }
+        return;
+    }
+
+    metrics_inc(report->epochs_metric);
+
+    if (!report->active)
+    {
+        if (report->warning)
+        {
+            LOG_WRN("%s", report->name);
+        }
+        else
+        {
+            LOG_INF("%s", report->name);
+        }
+
+        metrics_inc(report->events_metric);
+        report->active = true;
+        report->epochs = 1;
+        report->reported_epochs = 1;
+        report->started = now;
+        report->last_report = now;
+        return;
+    }
+
+    report->epochs++;
+
+    if (now - report->last_report < REPORT_INTERVAL_MS)
+    {
+        return;
+    }
+
+    if (report->warning)
+    {
+        LOG_WRN("%s (%u epochs, +%u since last report)", report->name,
+                report->epochs, report->epochs - report->reported_epochs);
+    }
+    else
+    {
+        LOG_INF("%s (%u epochs, +%u since last report)", report->name,
+                report->epochs, report->epochs - report->reported_epochs);
+    }
+
+    report->reported_epochs = report->epochs;
+    report->last_report = now;
+}
@@ -0,0 +1,47 @@
+/*
+Name : event_report.h
+
+Description :
+    Header file for the rate-limited event reporter. A condition that persists
+    over many epochs is logged once when it starts, then as a periodic count,
+    and once more when it clears.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _EVENT_REPORT_H
+#define _EVENT_REPORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "metrics.h"
+
+struct event_report
+{
+    /* Configuration. */
+    const char *name;
+    bool warning;
+    enum metrics_id events_metric;
+    enum metrics_id epochs_metric;
+
+    /* State. */
+    bool active;
+    uint32_t epochs;
+    uint32_t reported_epochs;
+    int64_t started;
+    int64_t last_report;
+};
+
+#define EVENT_REPORT_INIT(_name, _warning, _events_metric, _epochs_metric) \
+    {                                                                      \
+        .name = _name,                                                     \
+        .warning = _warning,                                               \
+        .events_metric = _events_metric,                                   \
+        .epochs_metric = _epochs_metric,                                   \
+    }
+
+void event_report_update(struct event_report *report, bool active, int64_t now);
+
+#endif
@@ -0,0 +1,384 @@
+/*
+Name : fast_trig.c
+
+Description :
+    This source file implements single precision trigonometric functions for the
+    geodesy code.
+
+    sin/cos use a 256 entry sine table over a full turn with cubic Hermite
+    interpolation. The derivative at each node is the cosine, read from the same
+    table a quarter turn ahead, so the interpolation error is bounded by
+    h^4 / 384 ~ 1e-9 (h = 2 * pi / 256), below single precision resolution.
+    The table is constant data in flash, so no initialization is needed and
+    the functions can be used before anything else has run.
+    asin and atan use the Cephes minimax polynomials after range reduction.
+
+    The file has no Zephyr dependencies so it can be built for the host
+    benchmark in tools/trig_bench.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include "fast_trig.h"
+
+#define TABLE_BITS 8
+#define TABLE_SIZE (1 << TABLE_BITS)
+#define QUARTER (TABLE_SIZE / 4)
+
+#define TWO_PI_D 6.28318530717958647692
+#define STEP ((float)(TWO_PI_D / TABLE_SIZE))
+#define INV_STEP ((float)(TABLE_SIZE / TWO_PI_D))
+
+/* STEP split for Cody-Waite reduction: STEP_HI has 14 significant bits, so
+ * node * STEP_HI is exact for the first 1024 nodes (|x| <= 8 * pi). */
+#define STEP_HI 0.024541854858398438f
+#define STEP_LO 1.8377477317699231e-06f
+
+#define HALF_PI (FAST_TRIG_PI / 2.0f)
+#define QUARTER_PI (FAST_TRIG_PI / 4.0f)
+#define TAN_3_PI_8 2.414213562373095f
+#define TAN_PI_8 0.4142135623730950f
+
+/* sin() at TABLE_SIZE nodes per turn, extended so cos = sin(x + pi/2) and the
+ * next node never need to wrap. Node i is (float)sin(i * 2 * pi / TABLE_SIZE)
+ * of the double precision libm sin(), printed with 9 significant digits so it
+ * converts back exactly. */
+static const float sin_table[TABLE_SIZE + QUARTER + 1] = {
+    0.00000000e0f, 2.45412290e-2f, 4.90676761e-2f, 7.35645667e-2f,
+    9.80171412e-2f, 1.22410677e-1f, 1.46730468e-1f, 1.70961887e-1f,
+    1.95090324e-1f, 2.19101235e-1f, 2.42980182e-1f, 2.66712755e-1f,
+    2.90284663e-1f, 3.13681751e-1f, 3.36889863e-1f, 3.59895051e-1f,
+    3.82683426e-1f, 4.05241311e-1f, 4.27555084e-1f, 4.49611336e-1f,
+    4.71396744e-1f, 4.92898196e-1f, 5.14102757e-1f, 5.34997642e-1f,
+    5.55570245e-1f, 5.75808167e-1f, 5.95699310e-1f, 6.15231574e-1f,
+    6.34393275e-1f, 6.53172851e-1f, 6.71558976e-1f, 6.89540565e-1f,
+    7.07106769e-1f, 7.24247098e-1f, 7.40951121e-1f, 7.57208824e-1f,
+    7.73010433e-1f, 7.88346410e-1f, 8.03207517e-1f, 8.17584813e-1f,
+    8.31469595e-1f, 8.44853580e-1f, 8.57728601e-1f, 8.70086968e-1f,
+    8.81921291e-1f, 8.93224299e-1f, 9.03989315e-1f, 9.14209783e-1f,
+    9.23879504e-1f, 9.32992816e-1f, 9.41544056e-1f, 9.49528158e-1f,
+    9.56940353e-1f, 9.63776052e-1f, 9.70031261e-1f, 9.75702107e-1f,
+    9.80785251e-1f, 9.85277653e-1f, 9.89176512e-1f, 9.92479563e-1f,
+    9.95184720e-1f, 9.97290432e-1f, 9.98795450e-1f, 9.99698818e-1f,
+    1.00000000e0f, 9.99698818e-1f, 9.98795450e-1f, 9.97290432e-1f,
+    9.95184720e-1f, 9.92479563e-1f, 9.89176512e-1f, 9.85277653e-1f,
+    9.80785251e-1f, 9.75702107e-1f, 9.70031261e-1f, 9.63776052e-1f,
+    9.56940353e-1f, 9.49528158e-1f, 9.41544056e-1f, 9.32992816e-1f,
+    9.23879504e-1f, 9.14209783e-1f, 9.03989315e-1f, 8.93224299e-1f,
+    8.81921291e-1f, 8.70086968e-1f, 8.57728601e-1f, 8.44853580e-1f,
+    8.31469595e-1f, 8.17584813e-1f, 8.03207517e-1f, 7.88346410e-1f,
+    7.73010433e-1f, 7.57208824e-1f, 7.40951121e-1f, 7.24247098e-1f,
+    7.07106769e-1f, 6.89540565e-1f, 6.71558976e-1f, 6.53172851e-1f,
+    6.34393275e-1f, 6.15231574e-1f, 5.95699310e-1f, 5.75808167e-1f,
+    5.55570245e-1f, 5.34997642e-1f, 5.14102757e-1f, 4.92898196e-1f,
+    4.71396744e-1f, 4.49611336e-1f, 4.27555084e-1f, 4.05241311e-1f,
+    3.82683426e-1f, 3.59895051e-1f, 3.36889863e-1f, 3.13681751e-1f,
+    2.90284663e-1f, 2.66712755e-1f, 2.42980182e-1f, 2.19101235e-1f,
+    1.95090324e-1f, 1.70961887e-1f, 1.46730468e-1f, 1.22410677e-1f,
+    9.80171412e-2f, 7.35645667e-2f, 4.90676761e-2f, 2.45412290e-2f,
+    1.22464685e-16f, -2.45412290e-2f, -4.90676761e-2f, -7.35645667e-2f,
+    -9.80171412e-2f, -1.22410677e-1f, -1.46730468e-1f, -1.70961887e-1f,
+    -1.95090324e-1f, -2.19101235e-1f, -2.42980182e-1f, -2.66712755e-1f,
+    -2.90284663e-1f, -3.13681751e-1f, -3.36889863e-1f, -3.59895051e-1f,
+    -3.82683426e-1f, -4.05241311e-1f, -4.27555084e-1f, -4.49611336e-1f,
+    -4.71396744e-1f, -4.92898196e-1f, -5.14102757e-1f, -5.34997642e-1f,
+    -5.55570245e-1f, -5.75808167e-1f, -5.95699310e-1f, -6.15231574e-1f,
+    -6.34393275e-1f, -6.53172851e-1f, -6.71558976e-1f, -6.89540565e-1f,
+    -7.07106769e-1f, -7.24247098e-1f, -7.40951121e-1f, -7.57208824e-1f,
+    -7.73010433e-1f, -7.88346410e-1f, -8.03207517e-1f, -8.17584813e-1f,
+    -8.31469595e-1f, -8.44853580e-1f, -8.57728601e-1f, -8.70086968e-1f,
+    -8.81921291e-1f, -8.93224299e-1f, -9.03989315e-1f, -9.14209783e-1f,
+    -9.23879504e-1f, -9.32992816e-1f, -9.41544056e-1f, -9.49528158e-1f,
+    -9.56940353e-1f, -9.63776052e-1f, -9.70031261e-1f, -9.75702107e-1f,
+    -9.80785251e-1f, -9.85277653e-1f, -9.89176512e-1f, -9.92479563e-1f,
+    -9.95184720e-1f, -9.97290432e-1f, -9.98795450e-1f, -9.99698818e-1f,
+    -1.00000000e0f, -9.99698818e-1f, -9.98795450e-1f, -9.97290432e-1f,
+    -9.95184720e-1f, -9.92479563e-1f, -9.89176512e-1f, -9.85277653e-1f,
+    -9.80785251e-1f, -9.75702107e-1f, -9.70031261e-1f, -9.63776052e-1f,
+    -9.56940353e-1f, -9.49528158e-1f, -9.41544056e-1f, -9.32992816e-1f,
+    -9.23879504e-1f, -9.14209783e-1f, -9.03989315e-1f, -8.93224299e-1f,
+    -8.81921291e-1f, -8.70086968e-1f, -8.57728601e-1f, -8.44853580e-1f,
+    -8.31469595e-1f, -8.17584813e-1f, -8.03207517e-1f, -7.88346410e-1f,
+    -7.73010433e-1f, -7.57208824e-1f, -7.40951121e-1f, -7.24247098e-1f,
+    -7.07106769e-1f, -6.89540565e-1f, -6.71558976e-1f, -6.53172851e-1f,
+    -6.34393275e-1f, -6.15231574e-1f, -5.95699310e-1f, -5.75808167e-1f,
+    -5.55570245e-1f, -5.34997642e-1f, -5.14102757e-1f, -4.92898196e-1f,
+    -4.71396744e-1f, -4.49611336e-1f, -4.27555084e-1f, -4.05241311e-1f,
+    -3.82683426e-1f, -3.59895051e-1f, -3.36889863e-1f, -3.13681751e-1f,
+    -2.90284663e-1f, -2.66712755e-1f, -2.42980182e-1f, -2.19101235e-1f,
+    -1.95090324e-1f, -1.70961887e-1f, -1.46730468e-1f, -1.22410677e-1f,
+    -9.80171412e-2f, -7.35645667e-2f, -4.90676761e-2f, -2.45412290e-2f,
+    -2.44929371e-16f, 2.45412290e-2f, 4.90676761e-2f, 7.35645667e-2f,
+    9.80171412e-2f, 1.22410677e-1f, 1.46730468e-1f, 1.70961887e-1f,
+    1.95090324e-1f, 2.19101235e-1f, 2.42980182e-1f, 2.66712755e-1f,
+    2.90284663e-1f, 3.13681751e-1f, 3.36889863e-1f, 3.59895051e-1f,
+    3.82683426e-1f, 4.05241311e-1f, 4.27555084e-1f, 4.49611336e-1f,
+    4.71396744e-1f, 4.92898196e-1f, 5.14102757e-1f, 5.34997642e-1f,
+    5.55570245e-1f, 5.75808167e-1f, 5.95699310e-1f, 6.15231574e-1f,
+    6.34393275e-1f, 6.53172851e-1f, 6.71558976e-1f, 6.89540565e-1f,
+    7.07106769e-1f, 7.24247098e-1f, 7.40951121e-1f, 7.57208824e-1f,
+    7.73010433e-1f, 7.88346410e-1f, 8.03207517e-1f, 8.17584813e-1f,
+    8.31469595e-1f, 8.44853580e-1f, 8.57728601e-1f, 8.70086968e-1f,
+    8.81921291e-1f, 8.93224299e-1f, 9.03989315e-1f, 9.14209783e-1f,
+    9.23879504e-1f, 9.32992816e-1f, 9.41544056e-1f, 9.49528158e-1f,
+    9.56940353e-1f, 9.63776052e-1f, 9.70031261e-1f, 9.75702107e-1f,
+    9.80785251e-1f, 9.85277653e-1f, 9.89176512e-1f, 9.92479563e-1f,
+    9.95184720e-1f, 9.97290432e-1f, 9.98795450e-1f, 9.99698818e-1f,
+    1.00000000e0f,
+};
+
+/*
+Function : reduce
+
+Description :
+    Splits an angle into a table node and the fraction of a step past it. The
+    remainder is computed in radians with a two-part step so the fraction does
+    not inherit the rounding error of x * INV_STEP.
+
+Parameter :
+    float x  - Angle in radians
+    float *f - Fraction of a step past the node, in [0, 1]
+
+Return :
+    int - Table index of the node
+
+Example Call :
+    int i = reduce(x, &f);
+*/
+static inline int reduce(float x, float *f)
+{
+    float node = floorf(x * INV_STEP);
+    float r = (x - node * STEP_HI) - node * STEP_LO;
+
+    *f = r * INV_STEP;
+    return (int)(int32_t)node & (TABLE_SIZE - 1);
+}
+
+/*
+Function : hermite
+
+Description :
+    Cubic Hermite interpolation between two table nodes, with the derivatives
+    already scaled by the step. Expanded in powers of f.
+
+Parameter :
+    float p0 - Value at the first node
+    float p1 - Value at the second node
+    float m0 - Step scaled derivative at the first node
+    float m1 - Step scaled derivative at the second node
+    float f  - Fraction of a step past the first node
+
+Return :
+    float - Interpolated value
+
+Example Call :
+    float s = hermite(s0, s1, STEP * c0, STEP * c1, f);
+*/
+static inline float hermite(float p0, float p1, float m0, float m1, float f)
+{
+    return p0 + f * (m0 + f * (3.0f * (p1 - p0) - 2.0f * m0 - m1 +
+                               f * (2.0f * (p0 - p1) + m0 + m1)));
+}
+
+/*
+Function : fast_sincosf
+
+Description :
+    Computes sine and cosine of an angle in one table lookup.
+
+Parameter :
+    float x      - Angle in radians, accurate to FAST_TRIG_SIN_MAX_ERROR
+                   for |x| <= 8 * pi
+    float *sin_x - Sine output
+    float *cos_x - Cosine output
+
+Return :
+    void
+
+Example Call :
+    fast_sincosf(lat_rad, &sin_lat, &cos_lat);
+*/
+void fast_sincosf(float x, float *sin_x, float *cos_x)
+{
+    float f;
+    int i = reduce(x, &f);
+
+    float s0 = sin_table[i];
+    float s1 = sin_table[i + 1];
+    float c0 = sin_table[i + QUARTER];
+    float c1 = sin_table[i + QUARTER + 1];
+
+    *sin_x = hermite(s0, s1, STEP * c0, STEP * c1, f);
+    *cos_x = hermite(c0, c1, -STEP * s0, -STEP * s1, f);
+}
+
+/*
+Function : fast_sinf
+
+Description :
+    Computes the sine of an angle.
+
+Parameter :
+    float x - Angle in radians, accurate for |x| <= 8 * pi
+
+Return :
+    float - sin(x)
+
+Example Call :
+    float s = fast_sinf(d_lat / 2.0f);
+*/
+float fast_sinf(float x)
+{
+    float f;
+    int i = reduce(x, &f);
+
+    return hermite(sin_table[i], sin_table[i + 1],
+                   STEP * sin_table[i + QUARTER], STEP * sin_table[i + QUARTER + 1], f);
+}
+
+/*
+Function : fast_cosf
+
+Description :
+    Computes the cosine of an angle.
+
+Parameter :
+    float x - Angle in radians, accurate for |x| <= 8 * pi
+
+Return :
+    float - cos(x)
+
+Example Call :
+    float c = fast_cosf(lat_rad);
+*/
+float fast_cosf(float x)
+{
+    float f;
+    int i = reduce(x, &f);
+
+    return hermite(sin_table[i + QUARTER], sin_table[i + QUARTER + 1],
+                   -STEP * sin_table[i], -STEP * sin_table[i + 1], f);
+}
+
+/*
+Function : asin_poly
+
+Description :
+    Cephes minimax polynomial for asin on [-0.5, 0.5].
+
+Parameter :
+    float x - Argument, |x| <= 0.5
+
+Return :
+    float - asin(x)
+
+Example Call :
+    float a = asin_poly(x);
+*/
+static float asin_poly(float x)
+{
+    float z = x * x;
+
+    return ((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z +
+             7.4953002686e-2f) * z + 1.6666752422e-1f) * z * x + x;
+}
+
+/*
+Function : fast_asinf
+
+Description :
+    Computes the arc sine. Arguments above 0.5 in magnitude are reduced with
+    asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)).
+
+Parameter :
+    float x - Argument, clamped to [-1, 1]
+
+Return :
+    float - asin(x) in radians
+
+Example Call :
+    float c = 2.0f * fast_asinf(sqrtf(a));
+*/
+float fast_asinf(float x)
+{
+    float a = fabsf(x);
+    float result;
+
+    if (a > 1.0f)
+    {
+        a = 1.0f;
+    }
+
+    if (a > 0.5f)
+    {
+        result = HALF_PI - 2.0f * asin_poly(sqrtf(0.5f * (1.0f - a)));
+    }
+    else
+    {
+        result = asin_poly(a);
+    }
+
+    return x < 0.0f ? -result : result;
+}
+
+/*
+Function : fast_atan2f
+
+Description :
+    Computes the four-quadrant arc tangent of y / x using the Cephes atan
+    polynomial after reduction to |t| <= tan(pi / 8).
+
+Parameter :
+    float y - Y coordinate
+    float x - X coordinate
+
+Return :
+    float - Angle in radians in [-pi, pi], 0 if both arguments are 0
+
+Example Call :
+    float bearing = fast_atan2f(east, north);
+*/
+float fast_atan2f(float y, float x)
+{
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float t;
+    float offset;
+
+    if (ax == 0.0f && ay == 0.0f)
+    {
+        return 0.0f;
+    }
+
+    /* atan of the ratio in the first octant pair, |ratio| in [0, inf). */
+    if (ay > TAN_3_PI_8 * ax)
+    {
+        offset = HALF_PI;
+        t = -ax / ay;
+    }
+    else if (ay > TAN_PI_8 * ax)
+    {
+        offset = QUARTER_PI;
+        t = (ay - ax) / (ay + ax);
+    }
+    else
+    {
+        offset = 0.0f;
+        t = ay / ax;
+    }
+
+    float z = t * t;
+    float angle = offset + (((8.05374449538e-2f * z - 1.38776856032e-1f) * z +
+                             1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t + t;
+
+    if (x < 0.0f)
+    {
+        angle = FAST_TRIG_PI - angle;
+    }
+
+    return y < 0.0f ? -angle : angle;
+}
@@ -0,0 +1,39 @@
+/*
+Name : fast_trig.h
+
+Description :
+    Header file for the single precision trigonometry library used by the geodesy
+    code. Replaces libm double precision sin/cos/asin/atan2, which are software
+    emulated on the Cortex-M33, with table and polynomial based float versions of
+    bounded error.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _FAST_TRIG_H
+#define _FAST_TRIG_H
+
+#define FAST_TRIG_PI 3.14159265358979323846f
+
+/* Maximum absolute error of fast_sinf/fast_cosf for |x| <= 8 * pi. */
+#define FAST_TRIG_SIN_MAX_ERROR 2.0e-7f
+
+/* Maximum absolute error (radians) of fast_asinf/fast_atan2f. */
+#define FAST_TRIG_ASIN_MAX_ERROR 3.0e-7f
+#define FAST_TRIG_ATAN_MAX_ERROR 3.0e-7f
+
+float fast_sinf(float x);
+
+float fast_cosf(float x);
+
+void fast_sincosf(float x, float *sin_x, float *cos_x);
+
+float fast_asinf(float x);
+
+float fast_atan2f(float y, float x);
+
+void fast_trig_bench(void);
+
+#endif
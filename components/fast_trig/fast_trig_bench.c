@@ -0,0 +1,94 @@
+/*
+Name : fast_trig_bench.c
+
+Description :
+    On-target benchmark for the fast trigonometry library. Measures cycles per
+    call of libm double, libm float and fast_trig, and the maximum absolute error
+    against libm double, and logs the results once at startup.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/timing/timing.h>
+#include "fast_trig.h"
+
+LOG_MODULE_REGISTER(TRIG_BENCH);
+
+#define SAMPLES 256
+
+static float angles[SAMPLES];
+static float unit[SAMPLES];
+
+static volatile float sink_f;
+static volatile double sink_d;
+
+/* CPU cycles are read with the timing API (DWT cycle counter on the M33);
+ * k_cycle_get_32() runs from the 32 kHz RTC on nRF91 and is too coarse. */
+#define BENCH(label, type, sink, expr)                                       \
+    do                                                                       \
+    {                                                                        \
+        type acc = 0;                                                        \
+        timing_t start = timing_counter_get();                               \
+        for (int i = 0; i < SAMPLES; i++)                                    \
+        {                                                                    \
+            acc += (expr);                                                   \
+        }                                                                    \
+        timing_t end = timing_counter_get();                                 \
+        sink = acc;                                                          \
+        LOG_INF("%-14s %5u cycles/call", label,                              \
+                (uint32_t)(timing_cycles_get(&start, &end) / SAMPLES));      \
+    } while (0)
+
+/*
+Function : fast_trig_bench
+
+Description :
+    Runs the benchmark and logs cycles per call and maximum errors.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    fast_trig_bench();
+*/
+void fast_trig_bench(void)
+{
+    double err_sin = 0;
+    double err_asin = 0;
+    double err_atan = 0;
+
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        angles[i] = (float)(-2.0 * M_PI + 4.0 * M_PI * i / SAMPLES);
+        unit[i] = (float)(-1.0 + 2.0 * i / SAMPLES);
+
+        err_sin = fmax(err_sin, fabs(fast_sinf(angles[i]) - sin(angles[i])));
+        err_asin = fmax(err_asin, fabs(fast_asinf(unit[i]) - asin(unit[i])));
+        err_atan = fmax(err_atan, fabs(fast_atan2f(unit[i], 0.5f) - atan2(unit[i], 0.5)));
+    }
+
+    LOG_INF("Max error: sin %.2e asin %.2e atan2 %.2e", err_sin, err_asin, err_atan);
+
+    timing_init();
+    timing_start();
+
+    BENCH("sin", double, sink_d, sin(angles[i]));
+    BENCH("sinf", float, sink_f, sinf(angles[i]));
+    BENCH("fast_sinf", float, sink_f, fast_sinf(angles[i]));
+    BENCH("asin", double, sink_d, asin(unit[i]));
+    BENCH("asinf", float, sink_f, asinf(unit[i]));
+    BENCH("fast_asinf", float, sink_f, fast_asinf(unit[i]));
+    BENCH("atan2", double, sink_d, atan2(unit[i], 0.5));
+    BENCH("atan2f", float, sink_f, atan2f(unit[i], 0.5f));
+    BENCH("fast_atan2f", float, sink_f, fast_atan2f(unit[i], 0.5f));
+
+    timing_stop();
+}
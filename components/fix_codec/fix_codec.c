@@ -0,0 +1,231 @@
+/*
+Name : fix_codec.c
+
+Description :
+    This source file implements the fix batch codec. A batch is a 16 byte
+    header followed by a 24 byte record per fix, all little-endian and written
+    byte by byte, so the format does not depend on the compiler or host:
+
+        header : magic, version, fix count, reserved (1 byte each),
+                 device id (u32), time of the first fix (i64, Unix ms)
+        fix    : time since the first fix (u32, ms),
+                 latitude, longitude (i32, 1e-7 degrees), altitude (i32, cm),
+                 accuracy (u16, dm), speed (u16, cm/s), heading (u16, 0.01 deg),
+                 satellites used, confidence (u8)
+
+    Values are rounded to the resolution above and saturated to the field
+    range. The decoder validates the header and the exact length, so a
+    truncated or foreign datagram is rejected rather than misread.
+
+    The file has no Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "fix_codec.h"
+
+/*
+Function : quantize
+
+Description :
+    Scales a value, rounds it to the nearest integer and saturates it.
+
+Parameter :
+    double value - Value
+    double scale - Units per value unit
+    double min   - Smallest result
+    double max   - Largest result
+
+Return :
+    int64_t - Quantized value
+
+Example Call :
+    int32_t lat = (int32_t)quantize(latitude, 1e7, -900000000, 900000000);
+*/
+static int64_t quantize(double value, double scale, double min, double max)
+{
+    double v = value * scale;
+
+    v = v < 0.0 ? v - 0.5 : v + 0.5;
+    if (!(v >= min))
+    {
+        v = min;
+    }
+    if (v > max)
+    {
+        v = max;
+    }
+
+    return (int64_t)v;
+}
+
+/*
+Function : put_le
+
+Description :
+    Writes an unsigned value in little-endian byte order.
+
+Parameter :
+    uint8_t *p     - Output
+    uint64_t value - Value
+    size_t bytes   - Field width in bytes
+
+Return :
+    void
+
+Example Call :
+    put_le(buf + 4, batch->device_id, 4);
+*/
+static void put_le(uint8_t *p, uint64_t value, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; i++)
+    {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/*
+Function : get_le
+
+Description :
+    Reads an unsigned value in little-endian byte order.
+
+Parameter :
+    const uint8_t *p - Input
+    size_t bytes     - Field width in bytes
+
+Return :
+    uint64_t - Value
+
+Example Call :
+    uint32_t device_id = (uint32_t)get_le(buf + 4, 4);
+*/
+static uint64_t get_le(const uint8_t *p, size_t bytes)
+{
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < bytes; i++)
+    {
+        value |= (uint64_t)p[i] << (8 * i);
+    }
+
+    return value;
+}
+
+/*
+Function : fix_codec_encode
+
+Description :
+    Encodes a batch. Fixes must not be older than the first one.
+
+Parameter :
+    const struct fix_codec_batch *batch - Batch, 1 to FIX_CODEC_MAX_FIXES fixes
+    uint8_t *buf                        - Output buffer
+    size_t size                         - Output buffer size
+
+Return :
+    int - Encoded length in bytes, -1 if the batch is invalid or does not fit
+
+Example Call :
+    int len = fix_codec_encode(&batch, buf, sizeof(buf));
+*/
+int fix_codec_encode(const struct fix_codec_batch *batch, uint8_t *buf, size_t size)
+{
+    size_t len = FIX_CODEC_HEADER_SIZE + (size_t)batch->count * FIX_CODEC_FIX_SIZE;
+
+    if (batch->count == 0 || batch->count > FIX_CODEC_MAX_FIXES || len > size)
+    {
+        return -1;
+    }
+
+    int64_t base = batch->fixes[0].timestamp_ms;
+
+    buf[0] = FIX_CODEC_MAGIC;
+    buf[1] = FIX_CODEC_VERSION;
+    buf[2] = batch->count;
+    buf[3] = 0;
+    put_le(buf + 4, batch->device_id, 4);
+    put_le(buf + 8, (uint64_t)base, 8);
+
+    for (uint8_t i = 0; i < batch->count; i++)
+    {
+        const struct fix_codec_fix *fix = &batch->fixes[i];
+        uint8_t *p = buf + FIX_CODEC_HEADER_SIZE + i * FIX_CODEC_FIX_SIZE;
+        int64_t dt = fix->timestamp_ms - base;
+
+        if (dt < 0 || dt > UINT32_MAX)
+        {
+            return -1;
+        }
+
+        int32_t latitude = (int32_t)quantize(fix->latitude, 1e7, -900000000, 900000000);
+        int32_t longitude = (int32_t)quantize(fix->longitude, 1e7, -1800000000, 1800000000);
+        int32_t altitude = (int32_t)quantize(fix->altitude, 100.0, INT32_MIN, INT32_MAX);
+
+        put_le(p, (uint64_t)dt, 4);
+        put_le(p + 4, (uint32_t)latitude, 4);
+        put_le(p + 8, (uint32_t)longitude, 4);
+        put_le(p + 12, (uint32_t)altitude, 4);
+        put_le(p + 16, (uint64_t)quantize(fix->accuracy, 10.0, 0, UINT16_MAX), 2);
+        put_le(p + 18, (uint64_t)quantize(fix->speed, 100.0, 0, UINT16_MAX), 2);
+        put_le(p + 20, (uint64_t)quantize(fix->heading, 100.0, 0, 35999), 2);
+        p[22] = fix->sv_used;
+        p[23] = fix->confidence;
+    }
+
+    return (int)len;
+}
+
+/*
+Function : fix_codec_decode
+
+Description :
+    Decodes a batch.
+
+Parameter :
+    const uint8_t *buf            - Encoded batch
+    size_t len                    - Encoded length in bytes
+    struct fix_codec_batch *batch - Decoded batch
+
+Return :
+    int - 0 on success, -1 if the data is not a valid batch
+
+Example Call :
+    if (fix_codec_decode(datagram, len, &batch) == 0) { ... }
+*/
+int fix_codec_decode(const uint8_t *buf, size_t len, struct fix_codec_batch *batch)
+{
+    if (len < FIX_CODEC_HEADER_SIZE || buf[0] != FIX_CODEC_MAGIC ||
+        buf[1] != FIX_CODEC_VERSION || buf[2] == 0 || buf[2] > FIX_CODEC_MAX_FIXES ||
+        len != FIX_CODEC_HEADER_SIZE + (size_t)buf[2] * FIX_CODEC_FIX_SIZE)
+    {
+        return -1;
+    }
+
+    int64_t base = (int64_t)get_le(buf + 8, 8);
+
+    batch->count = buf[2];
+    batch->device_id = (uint32_t)get_le(buf + 4, 4);
+
+    for (uint8_t i = 0; i < batch->count; i++)
+    {
+        struct fix_codec_fix *fix = &batch->fixes[i];
+        const uint8_t *p = buf + FIX_CODEC_HEADER_SIZE + i * FIX_CODEC_FIX_SIZE;
+
+        fix->timestamp_ms = base + (int64_t)get_le(p, 4);
+        fix->latitude = (int32_t)get_le(p + 4, 4) / 1e7;
+        fix->longitude = (int32_t)get_le(p + 8, 4) / 1e7;
+        fix->altitude = (float)((int32_t)get_le(p + 12, 4) / 100.0);
+        fix->accuracy = (float)get_le(p + 16, 2) / 10.0f;
+        fix->speed = (float)get_le(p + 18, 2) / 100.0f;
+        fix->heading = (float)get_le(p + 20, 2) / 100.0f;
+        fix->sv_used = p[22];
+        fix->confidence = p[23];
+    }
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*
+Name : fix_codec.h
+
+Description :
+    Header file for the fix batch codec. Declares the wire format of a batch of
+    fixes uplinked by a device, shared by device encoders and the host
+    ingestion tools, and its encoder and decoder.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _FIX_CODEC_H
+#define _FIX_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FIX_CODEC_MAGIC 0xf1
+#define FIX_CODEC_VERSION 1
+#define FIX_CODEC_MAX_FIXES 32
+
+#define FIX_CODEC_HEADER_SIZE 16
+#define FIX_CODEC_FIX_SIZE 24
+#define FIX_CODEC_MAX_SIZE (FIX_CODEC_HEADER_SIZE + FIX_CODEC_MAX_FIXES * FIX_CODEC_FIX_SIZE)
+
+struct fix_codec_fix
+{
+    int64_t timestamp_ms; /* UTC, Unix milliseconds */
+    double latitude;
+    double longitude;
+    float altitude; /* m */
+    float accuracy; /* m */
+    float speed;    /* m/s */
+    float heading;  /* degrees */
+    uint8_t sv_used;
+    uint8_t confidence;
+};
+
+struct fix_codec_batch
+{
+    uint32_t device_id;
+    uint8_t count;
+    struct fix_codec_fix fixes[FIX_CODEC_MAX_FIXES];
+};
+
+int fix_codec_encode(const struct fix_codec_batch *batch, uint8_t *buf, size_t size);
+
+int fix_codec_decode(const uint8_t *buf, size_t len, struct fix_codec_batch *batch);
+
+#endif
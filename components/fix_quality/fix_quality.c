@@ -0,0 +1,122 @@
+/*
+Name : fix_quality.c
+
+Description :
+    This source file implements the fix confidence score. Every input is mapped
+    to [0, 1] by a linear ramp between a "good" and a "bad" value, and the
+    weighted sum of the terms gives the score in percent. The weakest term caps
+    the score, so a fix with a single bad indicator (e.g. three satellites) can
+    not score high on the strength of the others.
+
+    The ramps and weights are in one table; tune them against recorded traces
+    by comparing the score with the actual position error. The file has no
+    Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdint.h>
+#include "fix_quality.h"
+
+enum fix_quality_term
+{
+    TERM_ACCURACY,
+    TERM_HDOP,
+    TERM_PDOP,
+    TERM_SV_USED,
+    TERM_CN0_SPREAD,
+    TERM_COUNT,
+};
+
+/* Linear ramp from 1 at "good" to 0 at "bad", and the weight of the term. The
+ * weights add up to 100. */
+static const struct
+{
+    float good;
+    float bad;
+    float weight;
+} terms[TERM_COUNT] = {
+    [TERM_ACCURACY] = {5.0f, 50.0f, 35.0f},    /* m */
+    [TERM_HDOP] = {1.0f, 5.0f, 20.0f},
+    [TERM_PDOP] = {1.5f, 8.0f, 10.0f},
+    [TERM_SV_USED] = {8.0f, 3.0f, 25.0f},
+    [TERM_CN0_SPREAD] = {60.0f, 250.0f, 10.0f}, /* 0.1 dB-Hz */
+};
+
+/* Score added to the weakest term for the cap, so one marginal term lowers the
+ * score without zeroing it. */
+#define CAP_MARGIN 0.4f
+
+/*
+Function : ramp
+
+Description :
+    Maps a value to [0, 1] on the ramp of a term. Works for both increasing
+    (good > bad) and decreasing (good < bad) ramps.
+
+Parameter :
+    enum fix_quality_term term - Term
+    float value                - Input value
+
+Return :
+    float - Sub-score in [0, 1]
+
+Example Call :
+    float s = ramp(TERM_HDOP, input->hdop);
+*/
+static float ramp(enum fix_quality_term term, float value)
+{
+    float s = (terms[term].bad - value) / (terms[term].bad - terms[term].good);
+
+    if (!(s > 0.0f)) /* Also catches NaN */
+    {
+        return 0.0f;
+    }
+    return s < 1.0f ? s : 1.0f;
+}
+
+/*
+Function : fix_quality_score
+
+Description :
+    Computes the confidence score of a fix.
+
+Parameter :
+    const struct fix_quality_input *input - Fix inputs
+
+Return :
+    uint8_t - Confidence, 0 (unusable) to 100
+
+Example Call :
+    fix.confidence = fix_quality_score(&input);
+*/
+uint8_t fix_quality_score(const struct fix_quality_input *input)
+{
+    float s[TERM_COUNT];
+    float sum = 0.0f;
+    float weakest = 1.0f;
+
+    s[TERM_ACCURACY] = ramp(TERM_ACCURACY, input->accuracy_m);
+    s[TERM_HDOP] = ramp(TERM_HDOP, input->hdop);
+    s[TERM_PDOP] = ramp(TERM_PDOP, input->pdop);
+    s[TERM_SV_USED] = ramp(TERM_SV_USED, input->sv_used);
+    s[TERM_CN0_SPREAD] = ramp(TERM_CN0_SPREAD,
+                              (float)input->cn0_max - (float)input->cn0_min);
+
+    for (int i = 0; i < TERM_COUNT; i++)
+    {
+        sum += terms[i].weight * s[i];
+        weakest = s[i] < weakest ? s[i] : weakest;
+    }
+
+    float cap = 100.0f * (weakest + CAP_MARGIN);
+
+    if (sum > cap)
+    {
+        sum = cap;
+    }
+
+    return (uint8_t)(sum + 0.5f);
+}
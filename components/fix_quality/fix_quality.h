@@ -0,0 +1,33 @@
+/*
+Name : fix_quality.h
+
+Description :
+    Header file for fix confidence scoring. Declares the per-fix inputs (DOP,
+    satellites used, CN0 spread, estimated accuracy) and the function combining
+    them into a single 0-100 confidence score consumers can compare against a
+    threshold.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _FIX_QUALITY_H
+#define _FIX_QUALITY_H
+
+#include <stdint.h>
+
+/* Inputs of one fix. CN0 in 0.1 dB-Hz, as in struct gnss_sv_msg. */
+struct fix_quality_input
+{
+    float hdop;
+    float pdop;
+    float accuracy_m;
+    uint8_t sv_used;
+    uint16_t cn0_min;
+    uint16_t cn0_max;
+};
+
+uint8_t fix_quality_score(const struct fix_quality_input *input);
+
+#endif
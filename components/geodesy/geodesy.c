@@ -0,0 +1,397 @@
+/*
+Name : geodesy.c
+
+Description :
+    This source file implements spherical earth geodesy on top of the fast_trig
+    functions: haversine distance, initial bearing, destination point and
+    cross/along-track distances. Distance and bearing from an origin share one
+    set of trigonometric terms, and cross/along-track distances are derived
+    from them, so a fix is evaluated against an origin or track in one pass.
+
+    Coordinate differences are formed in double precision before the float
+    trigonometry, so short distances keep their precision. The file has no
+    Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include "fast_trig.h"
+#include "geodesy.h"
+
+#define PI 3.14159265358979323846
+#define DEG_TO_RAD (PI / 180.0)
+#define RAD_TO_DEG (180.0 / PI)
+
+/* Per-fix terms shared by distance, bearing and track computations. */
+struct geo_terms
+{
+    float central_angle; /* Angular distance from the origin, radians */
+    float bearing;       /* Initial bearing from the origin, radians */
+};
+
+/*
+Function : terms_get
+
+Description :
+    Computes the angular distance (haversine) and initial bearing from an
+    origin to a point with three table lookups. The bearing denominator
+    cos(lat1) sin(lat2) - sin(lat1) cos(lat2) cos(dlon) is rewritten as
+    sin(dlat) + 2 sin(lat1) cos(lat2) sin^2(dlon / 2) to avoid cancellation
+    at short range.
+
+Parameter :
+    const struct geo_origin *origin - Origin
+    double latitude                 - Latitude of the point (in degrees)
+    double longitude                - Longitude of the point (in degrees)
+    struct geo_terms *terms         - Output terms
+
+Return :
+    void
+
+Example Call :
+    terms_get(origin, pvt->latitude, pvt->longitude, &terms);
+*/
+static void terms_get(const struct geo_origin *origin, double latitude, double longitude,
+                      struct geo_terms *terms)
+{
+    float sin_half_dlat, cos_half_dlat;
+    float sin_half_dlon, cos_half_dlon;
+
+    fast_sincosf((float)((latitude - origin->latitude) * DEG_TO_RAD / 2),
+                 &sin_half_dlat, &cos_half_dlat);
+    fast_sincosf((float)((longitude - origin->longitude) * DEG_TO_RAD / 2),
+                 &sin_half_dlon, &cos_half_dlon);
+
+    float cos_lat2 = fast_cosf((float)(latitude * DEG_TO_RAD));
+    float hav_dlon = sin_half_dlon * sin_half_dlon;
+
+    float a = sin_half_dlat * sin_half_dlat + origin->cos_lat * cos_lat2 * hav_dlon;
+
+    terms->central_angle = 2.0f * fast_asinf(sqrtf(fminf(a, 1.0f)));
+
+    float y = 2.0f * sin_half_dlon * cos_half_dlon * cos_lat2;
+    float x = 2.0f * sin_half_dlat * cos_half_dlat +
+              2.0f * origin->sin_lat * cos_lat2 * hav_dlon;
+
+    terms->bearing = fast_atan2f(y, x);
+}
+
+/*
+Function : bearing_to_deg
+
+Description :
+    Converts a bearing in radians in [-pi, pi] to degrees in [0, 360).
+
+Parameter :
+    float bearing - Bearing in radians
+
+Return :
+    float - Bearing in degrees
+
+Example Call :
+    nav->bearing_deg = bearing_to_deg(terms.bearing);
+*/
+static float bearing_to_deg(float bearing)
+{
+    float deg = bearing * (float)RAD_TO_DEG;
+
+    if (deg < 0.0f)
+    {
+        deg += 360.0f;
+    }
+
+    return deg >= 360.0f ? 0.0f : deg;
+}
+
+/*
+Function : geo_origin_set
+
+Description :
+    Sets an origin and precomputes the trigonometry of its latitude.
+
+Parameter :
+    struct geo_origin *origin - Origin to set
+    double latitude           - Latitude (in degrees)
+    double longitude          - Longitude (in degrees)
+
+Return :
+    void
+
+Example Call :
+    geo_origin_set(&ref_origin, 61.4937533, 23.7758897);
+*/
+void geo_origin_set(struct geo_origin *origin, double latitude, double longitude)
+{
+    origin->latitude = latitude;
+    origin->longitude = longitude;
+    fast_sincosf((float)(latitude * DEG_TO_RAD), &origin->sin_lat, &origin->cos_lat);
+}
+
+/*
+Function : geo_nav_get
+
+Description :
+    Computes the distance and initial bearing from an origin to a point.
+    The track fields of the result are set to zero.
+
+Parameter :
+    const struct geo_origin *origin - Origin
+    double latitude                 - Latitude of the point (in degrees)
+    double longitude                - Longitude of the point (in degrees)
+    struct geo_nav *nav             - Result
+
+Return :
+    void
+
+Example Call :
+    geo_nav_get(&ref_origin, pvt->latitude, pvt->longitude, &nav);
+*/
+void geo_nav_get(const struct geo_origin *origin, double latitude, double longitude,
+                 struct geo_nav *nav)
+{
+    struct geo_terms terms;
+
+    terms_get(origin, latitude, longitude, &terms);
+
+    nav->distance_m = (float)GEO_EARTH_RADIUS_METERS * terms.central_angle;
+    nav->bearing_deg = bearing_to_deg(terms.bearing);
+    nav->cross_track_m = 0.0f;
+    nav->along_track_m = 0.0f;
+}
+
+/*
+Function : geo_track_set
+
+Description :
+    Sets a great-circle track from a start point towards an end point and
+    precomputes its initial course.
+
+Parameter :
+    struct geo_track *track - Track to set
+    double start_lat        - Latitude of the start (in degrees)
+    double start_lon        - Longitude of the start (in degrees)
+    double end_lat          - Latitude of the end (in degrees)
+    double end_lon          - Longitude of the end (in degrees)
+
+Return :
+    void
+
+Example Call :
+    geo_track_set(&track, ref_lat, ref_lon, target_lat, target_lon);
+*/
+void geo_track_set(struct geo_track *track, double start_lat, double start_lon,
+                   double end_lat, double end_lon)
+{
+    struct geo_terms terms;
+
+    geo_origin_set(&track->start, start_lat, start_lon);
+    terms_get(&track->start, end_lat, end_lon, &terms);
+
+    fast_sincosf(terms.bearing, &track->sin_course, &track->cos_course);
+    track->length_m = (float)GEO_EARTH_RADIUS_METERS * terms.central_angle;
+}
+
+/*
+Function : geo_track_nav_get
+
+Description :
+    Computes the distance and bearing from the start of a track to a point,
+    and the cross-track and along-track distances of the point, in one pass.
+    With angular distance d and bearing difference t between the point and the
+    track course:
+        cross-track = asin(sin(d) sin(t))
+        along-track = atan2(sin(d) cos(t), cos(d))
+
+Parameter :
+    const struct geo_track *track - Track
+    double latitude               - Latitude of the point (in degrees)
+    double longitude              - Longitude of the point (in degrees)
+    struct geo_nav *nav           - Result
+
+Return :
+    void
+
+Example Call :
+    geo_track_nav_get(&track, pvt->latitude, pvt->longitude, &nav);
+*/
+void geo_track_nav_get(const struct geo_track *track, double latitude, double longitude,
+                       struct geo_nav *nav)
+{
+    struct geo_terms terms;
+    float sin_d, cos_d;
+    float sin_b, cos_b;
+
+    terms_get(&track->start, latitude, longitude, &terms);
+
+    fast_sincosf(terms.central_angle, &sin_d, &cos_d);
+    fast_sincosf(terms.bearing, &sin_b, &cos_b);
+
+    /* sin/cos of (bearing - course) by angle difference identities. */
+    float sin_t = sin_b * track->cos_course - cos_b * track->sin_course;
+    float cos_t = cos_b * track->cos_course + sin_b * track->sin_course;
+
+    nav->distance_m = (float)GEO_EARTH_RADIUS_METERS * terms.central_angle;
+    nav->bearing_deg = bearing_to_deg(terms.bearing);
+    nav->cross_track_m = (float)GEO_EARTH_RADIUS_METERS * fast_asinf(sin_d * sin_t);
+    nav->along_track_m = (float)GEO_EARTH_RADIUS_METERS * fast_atan2f(sin_d * cos_t, cos_d);
+}
+
+/*
+Function : geo_destination
+
+Description :
+    Computes the point reached by travelling a distance along a great circle
+    from an origin with a given initial bearing. The result resolution is about
+    one meter (single precision latitude).
+
+Parameter :
+    const struct geo_origin *origin - Origin
+    float bearing_deg               - Initial bearing (in degrees)
+    float distance_m                - Distance (in meters)
+    double *latitude                - Latitude of the destination (in degrees)
+    double *longitude               - Longitude of the destination (in degrees)
+
+Return :
+    void
+
+Example Call :
+    geo_destination(&ref_origin, 90.0f, 1000.0f, &lat, &lon);
+*/
+void geo_destination(const struct geo_origin *origin, float bearing_deg, float distance_m,
+                     double *latitude, double *longitude)
+{
+    float sin_d, cos_d;
+    float sin_b, cos_b;
+
+    fast_sincosf(distance_m / (float)GEO_EARTH_RADIUS_METERS, &sin_d, &cos_d);
+    fast_sincosf(bearing_deg * (float)DEG_TO_RAD, &sin_b, &cos_b);
+
+    float sin_lat2 = origin->sin_lat * cos_d + origin->cos_lat * sin_d * cos_b;
+    float lat2 = fast_asinf(sin_lat2);
+    float dlon = fast_atan2f(sin_b * sin_d * origin->cos_lat,
+                             cos_d - origin->sin_lat * sin_lat2);
+
+    double lon2 = origin->longitude + dlon * RAD_TO_DEG;
+
+    if (lon2 > 180.0)
+    {
+        lon2 -= 360.0;
+    }
+    else if (lon2 < -180.0)
+    {
+        lon2 += 360.0;
+    }
+
+    *latitude = lat2 * RAD_TO_DEG;
+    *longitude = lon2;
+}
+
+/*
+Function : geo_distance
+
+Description :
+    Calculates the great-circle distance (in meters) between two GPS coordinates
+    using the Haversine formula.
+
+Parameter :
+    double lat1 - Latitude of the first point (in degrees)
+    double lon1 - Longitude of the first point (in degrees)
+    double lat2 - Latitude of the second point (in degrees)
+    double lon2 - Longitude of the second point (in degrees)
+
+Return :
+    double - Distance in meters between the two points
+
+Example Call :
+    double dist = geo_distance(59.3293, 18.0686, 60.1695, 24.9354);
+*/
+double geo_distance(double lat1, double lon1, double lat2, double lon2)
+{
+    struct geo_origin origin;
+    struct geo_terms terms;
+
+    geo_origin_set(&origin, lat1, lon1);
+    terms_get(&origin, lat2, lon2, &terms);
+
+    return GEO_EARTH_RADIUS_METERS * terms.central_angle;
+}
+
+/*
+Function : geo_flat_distance
+
+Description :
+    Calculates the distance (in meters) between two GPS coordinates with the
+    equirectangular (flat earth) approximation. Cheapest of the distance
+    functions, only suitable for short distances away from the poles.
+
+Parameter :
+    double lat1 - Latitude of the first point (in degrees)
+    double lon1 - Longitude of the first point (in degrees)
+    double lat2 - Latitude of the second point (in degrees)
+    double lon2 - Longitude of the second point (in degrees)
+
+Return :
+    double - Distance in meters between the two points
+
+Example Call :
+    double dist = geo_flat_distance(61.4937, 23.7758, 61.4940, 23.7762);
+*/
+double geo_flat_distance(double lat1, double lon1, double lat2, double lon2)
+{
+    float x = (float)((lon2 - lon1) * DEG_TO_RAD) *
+              fast_cosf((float)((lat1 + lat2) * (DEG_TO_RAD / 2)));
+    float y = (float)((lat2 - lat1) * DEG_TO_RAD);
+
+    return GEO_EARTH_RADIUS_METERS * sqrtf(x * x + y * y);
+}
+
+/*
+Function : geo_geohash
+
+Description :
+    Encodes a position as a binary geohash: longitude and latitude bisection
+    bits interleaved, longitude first. Five bits make one character of the
+    usual base-32 geohash, e.g. 25 bits is a cell of about 4.9 km x 4.9 km.
+
+Parameter :
+    double latitude  - Latitude (in degrees)
+    double longitude - Longitude (in degrees)
+    uint8_t bits     - Number of bits, at most 32
+
+Return :
+    uint32_t - Geohash, bits long
+
+Example Call :
+    uint32_t cell = geo_geohash(pvt->latitude, pvt->longitude, 25);
+*/
+uint32_t geo_geohash(double latitude, double longitude, uint8_t bits)
+{
+    double lat_lo = -90.0, lat_hi = 90.0;
+    double lon_lo = -180.0, lon_hi = 180.0;
+    uint32_t hash = 0;
+
+    for (uint8_t i = 0; i < bits && i < 32; i++)
+    {
+        double *lo = (i % 2 == 0) ? &lon_lo : &lat_lo;
+        double *hi = (i % 2 == 0) ? &lon_hi : &lat_hi;
+        double value = (i % 2 == 0) ? longitude : latitude;
+        double mid = (*lo + *hi) / 2;
+
+        hash <<= 1;
+        if (value >= mid)
+        {
+            hash |= 1;
+            *lo = mid;
+        }
+        else
+        {
+            *hi = mid;
+        }
+    }
+
+    return hash;
+}
@@ -0,0 +1,86 @@
+/*
+Name : geodesy.h
+
+Description :
+    Header file for the geodesy functions. Declares great-circle distance,
+    bearing, destination point and cross/along-track computations on a
+    spherical earth. The trigonometry of a fixed origin (e.g. the reference
+    position) or track is precomputed once, so every fix costs a single pass.
+    Also declares the flat earth approximation, binary geohash cells and the
+    WGS-84 ellipsoidal distance (geodesy_ellipsoid.c).
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _GEODESY_H
+#define _GEODESY_H
+
+#include <stdint.h>
+
+#define GEO_EARTH_RADIUS_METERS (6371.0 * 1000.0)
+
+/* Fixed point with precomputed trigonometry. */
+struct geo_origin
+{
+    double latitude;
+    double longitude;
+    float sin_lat;
+    float cos_lat;
+};
+
+/* Great-circle track from a start point towards a target. */
+struct geo_track
+{
+    struct geo_origin start;
+    float sin_course;
+    float cos_course;
+    float length_m;
+};
+
+/* Fixed point on the WGS-84 ellipsoid with cached Vincenty terms. */
+struct geo_wgs84_origin
+{
+    double latitude;
+    double longitude;
+    double sin_u; /* Reduced latitude terms */
+    double cos_u;
+    double lambda_offset; /* Converged lambda - L of the last solution */
+};
+
+/* Position of a fix relative to an origin or track. */
+struct geo_nav
+{
+    float distance_m;    /* Great-circle distance from the origin */
+    float bearing_deg;   /* Initial bearing from the origin, [0, 360) */
+    float cross_track_m; /* Distance right (+) or left (-) of the track */
+    float along_track_m; /* Distance along the track from its start */
+};
+
+void geo_origin_set(struct geo_origin *origin, double latitude, double longitude);
+
+void geo_nav_get(const struct geo_origin *origin, double latitude, double longitude,
+                 struct geo_nav *nav);
+
+void geo_track_set(struct geo_track *track, double start_lat, double start_lon,
+                   double end_lat, double end_lon);
+
+void geo_track_nav_get(const struct geo_track *track, double latitude, double longitude,
+                       struct geo_nav *nav);
+
+void geo_destination(const struct geo_origin *origin, float bearing_deg, float distance_m,
+                     double *latitude, double *longitude);
+
+double geo_distance(double lat1, double lon1, double lat2, double lon2);
+
+double geo_flat_distance(double lat1, double lon1, double lat2, double lon2);
+
+uint32_t geo_geohash(double latitude, double longitude, uint8_t bits);
+
+void geo_wgs84_origin_set(struct geo_wgs84_origin *origin, double latitude, double longitude);
+
+int geo_wgs84_distance(struct geo_wgs84_origin *origin, double latitude, double longitude,
+                       double *distance_m);
+
+#endif
@@ -0,0 +1,181 @@
+/*
+Name : geodesy_ellipsoid.c
+
+Description :
+    This source file implements ellipsoidal (WGS-84) distances with Vincenty's
+    inverse formula, for uses where the up to 0.5 % error of the spherical
+    haversine is too large, such as odometry.
+
+    The reduced latitude terms of a fixed origin are cached, and the converged
+    longitude correction of the previous solution is used as the starting point
+    of the next one. Consecutive fixes are close to each other, so the iteration
+    normally converges in one or two steps. The number of iterations is capped;
+    nearly antipodal points that do not converge fall back to haversine.
+
+    Double precision libm is used here on purpose: single precision cannot
+    represent millimeter differences at earth scale.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include "geodesy.h"
+
+#define PI 3.14159265358979323846
+#define DEG_TO_RAD (PI / 180.0)
+
+#define WGS84_A 6378137.0
+#define WGS84_F (1.0 / 298.257223563)
+#define WGS84_B (WGS84_A * (1.0 - WGS84_F))
+
+/* Change of lambda between iterations considered converged (~0.006 mm). */
+#define CONVERGENCE 1e-12
+
+#if defined(CONFIG_GNSS_SAMPLE_VINCENTY_MAX_ITERATIONS)
+#define MAX_ITERATIONS CONFIG_GNSS_SAMPLE_VINCENTY_MAX_ITERATIONS
+#else
+#define MAX_ITERATIONS 20
+#endif
+
+/*
+Function : reduced_latitude
+
+Description :
+    Computes sine and cosine of the reduced latitude U, tan(U) = (1 - f) tan(lat).
+
+Parameter :
+    double latitude - Geodetic latitude (in degrees)
+    double *sin_u   - sin(U) output
+    double *cos_u   - cos(U) output
+
+Return :
+    void
+
+Example Call :
+    reduced_latitude(latitude, &sin_u2, &cos_u2);
+*/
+static void reduced_latitude(double latitude, double *sin_u, double *cos_u)
+{
+    double tan_u = (1.0 - WGS84_F) * tan(latitude * DEG_TO_RAD);
+
+    *cos_u = 1.0 / sqrt(1.0 + tan_u * tan_u);
+    *sin_u = tan_u * *cos_u;
+}
+
+/*
+Function : geo_wgs84_origin_set
+
+Description :
+    Sets an ellipsoidal origin and caches its reduced latitude terms.
+
+Parameter :
+    struct geo_wgs84_origin *origin - Origin to set
+    double latitude                 - Latitude (in degrees)
+    double longitude                - Longitude (in degrees)
+
+Return :
+    void
+
+Example Call :
+    geo_wgs84_origin_set(&odometer_origin, pvt->latitude, pvt->longitude);
+*/
+void geo_wgs84_origin_set(struct geo_wgs84_origin *origin, double latitude, double longitude)
+{
+    origin->latitude = latitude;
+    origin->longitude = longitude;
+    reduced_latitude(latitude, &origin->sin_u, &origin->cos_u);
+    origin->lambda_offset = 0.0;
+}
+
+/*
+Function : geo_wgs84_distance
+
+Description :
+    Calculates the WGS-84 ellipsoidal distance from an origin to a point with
+    Vincenty's inverse formula, warm started from the previous solution for
+    this origin.
+
+Parameter :
+    struct geo_wgs84_origin *origin - Origin, its warm start term is updated
+    double latitude                 - Latitude of the point (in degrees)
+    double longitude                - Longitude of the point (in degrees)
+    double *distance_m              - Distance in meters
+
+Return :
+    int - Number of iterations used, or -1 if the iteration did not converge
+          and the haversine distance was returned instead
+
+Example Call :
+    geo_wgs84_distance(&origin, pvt->latitude, pvt->longitude, &distance);
+*/
+int geo_wgs84_distance(struct geo_wgs84_origin *origin, double latitude, double longitude,
+                       double *distance_m)
+{
+    double sin_u1 = origin->sin_u;
+    double cos_u1 = origin->cos_u;
+    double sin_u2, cos_u2;
+
+    reduced_latitude(latitude, &sin_u2, &cos_u2);
+
+    double l = (longitude - origin->longitude) * DEG_TO_RAD;
+    double lambda = l + origin->lambda_offset;
+    double sin_sigma, cos_sigma, sigma, cos2_alpha, cos_2sigma_m;
+
+    for (int i = 1; i <= MAX_ITERATIONS; i++)
+    {
+        double sin_lambda = sin(lambda);
+        double cos_lambda = cos(lambda);
+        double t1 = cos_u2 * sin_lambda;
+        double t2 = cos_u1 * sin_u2 - sin_u1 * cos_u2 * cos_lambda;
+
+        sin_sigma = sqrt(t1 * t1 + t2 * t2);
+        if (sin_sigma == 0.0)
+        {
+            /* Coincident points. */
+            *distance_m = 0.0;
+            return i;
+        }
+
+        cos_sigma = sin_u1 * sin_u2 + cos_u1 * cos_u2 * cos_lambda;
+        sigma = atan2(sin_sigma, cos_sigma);
+
+        double sin_alpha = cos_u1 * cos_u2 * sin_lambda / sin_sigma;
+
+        cos2_alpha = 1.0 - sin_alpha * sin_alpha;
+
+        /* Zero on the equator, where cos2_alpha is zero. */
+        cos_2sigma_m = cos2_alpha != 0.0 ? cos_sigma - 2.0 * sin_u1 * sin_u2 / cos2_alpha : 0.0;
+
+        double c = WGS84_F / 16.0 * cos2_alpha * (4.0 + WGS84_F * (4.0 - 3.0 * cos2_alpha));
+        double prev = lambda;
+
+        lambda = l + (1.0 - c) * WGS84_F * sin_alpha *
+                         (sigma + c * sin_sigma *
+                                      (cos_2sigma_m + c * cos_sigma *
+                                                          (-1.0 + 2.0 * cos_2sigma_m * cos_2sigma_m)));
+
+        if (fabs(lambda - prev) < CONVERGENCE)
+        {
+            double u2 = cos2_alpha * (WGS84_A * WGS84_A - WGS84_B * WGS84_B) / (WGS84_B * WGS84_B);
+            double a = 1.0 + u2 / 16384.0 * (4096.0 + u2 * (-768.0 + u2 * (320.0 - 175.0 * u2)));
+            double b = u2 / 1024.0 * (256.0 + u2 * (-128.0 + u2 * (74.0 - 47.0 * u2)));
+            double c2 = cos_2sigma_m * cos_2sigma_m;
+            double delta_sigma =
+                b * sin_sigma *
+                (cos_2sigma_m + b / 4.0 *
+                                    (cos_sigma * (-1.0 + 2.0 * c2) -
+                                     b / 6.0 * cos_2sigma_m * (-3.0 + 4.0 * sin_sigma * sin_sigma) *
+                                         (-3.0 + 4.0 * c2)));
+
+            origin->lambda_offset = lambda - l;
+            *distance_m = WGS84_B * a * (sigma - delta_sigma);
+            return i;
+        }
+    }
+
+    origin->lambda_offset = 0.0;
+    *distance_m = geo_distance(origin->latitude, origin->longitude, latitude, longitude);
+    return -1;
+}
@@ -4,8 +4,8 @@ Name : gnss.c
 Description :  
     This source file implements GNSS functionality using Nordic's nRF modem GNSS API.
     It handles GNSS initialization, configuration, event processing, satellite tracking,
-    and periodic fix reporting. It also includes utilities for calculating distances
-    and logging GNSS data in a terminal-friendly format.
+    and periodic fix reporting. It also reports the distance and bearing from a
+    reference position and logs GNSS data in a terminal-friendly format.
 
 Developer : Engr Akbar Shah
 
@@ -18,107 +18,236 @@ Date : May 16, 2025
 #include <math.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 #include <nrf_modem_at.h>
 #include <modem/lte_lc.h>
 #include <nrf_modem_gnss.h>
 #include "gnss.h"
+#include "gnss_bus.h"
+#include "gnss_sm.h"
+#include "log_stats.h"
+#include "energy_monitor.h"
+#include "sleep_stats.h"
+#include "event_report.h"
+#include "metrics.h"
+#include "geodesy.h"
+#include "gnss_time.h"
+#include "fix_quality.h"
+#include "ephemeris.h"
+#include "ttff_model.h"
+#include "altitude.h"
+#include "baro.h"
+#include "heading.h"
+#include "sv_history.h"
 
 LOG_MODULE_REGISTER(GNSS);
 
-#define PI 3.14159265358979323846
-#define EARTH_RADIUS_METERS (6371.0 * 1000.0)
-
-#define DEG_TO_RAD (PI / 180.0)
-
 static const char update_indicator[] = {'\\', '|', '/', '-'};
 static uint32_t fix_timestamp;
 
 static struct nrf_modem_gnss_pvt_data_frame last_pvt;
 
+/* Terminal lines printed for the current epoch, cleared by refresh_display(). */
+static int display_lines;
+
+/*
+Function : display_line_count
+
+Description : 
+    Counts the terminal lines a log message takes: its own line plus one for
+    every newline in the format.
+
+Parameter : 
+    const char *fmt - Log message format
+
+Return : 
+    int - Number of lines
+
+Example Call : 
+    display_lines += display_line_count("Confidence: %u %%\n");
+*/
+static int display_line_count(const char *fmt)
+{
+    int lines = 1;
+
+    for (; *fmt != '\0'; fmt++)
+    {
+        lines += *fmt == '\n';
+    }
+
+    return lines;
+}
+
+/* Logs a line of the epoch printout and counts it for refresh_display(). */
+#define DISPLAY_INF(fmt, ...)                                                                \
+    do                                                                                       \
+    {                                                                                        \
+        LOG_INF(fmt, ##__VA_ARGS__);                                                         \
+        display_lines += display_line_count(fmt);                                            \
+    } while (0)
+
 /* Reference position. */
-bool ref_used;
-double ref_latitude;
-double ref_longitude;
+static bool ref_used;
+static struct geo_origin ref_origin;
+#if defined(CONFIG_GNSS_SAMPLE_DISTANCE_ELLIPSOIDAL)
+static struct geo_wgs84_origin ref_wgs84;
+#endif
 
 uint8_t cnt = 0;
 struct nrf_modem_gnss_nmea_data_frame *nmea_data;
 
-K_MSGQ_DEFINE(nmea_queue, sizeof(struct nrf_modem_gnss_nmea_data_frame *), 10, 4);
+/* Holds the NMEA sentences of one epoch (up to 4 GSV) until they are drained.
+ * Frames come from a static pool, the application does not need a heap. */
+#define NMEA_QUEUE_SIZE 16
+
+K_MEM_SLAB_DEFINE_STATIC(nmea_slab, sizeof(struct nrf_modem_gnss_nmea_data_frame),
+                         NMEA_QUEUE_SIZE, 4);
+K_MSGQ_DEFINE(nmea_queue, sizeof(struct nrf_modem_gnss_nmea_data_frame *), NMEA_QUEUE_SIZE, 4);
 static K_SEM_DEFINE(pvt_data_sem, 0, 1);
+static struct k_poll_signal wakeup_signal = K_POLL_SIGNAL_INITIALIZER(wakeup_signal);
+
+static bool gnss_running;
+
+/* Requested use case options, applied when GNSS is (re)started. */
+static bool low_accuracy = IS_ENABLED(CONFIG_GNSS_SAMPLE_LOW_ACCURACY);
+static bool ephemeris_refresh;
+static uint8_t use_case_applied;
+
+#define LOW_ACCURACY_APPLIED (use_case_applied & NRF_MODEM_GNSS_USE_CASE_LOW_ACCURACY)
+
+static struct ephemeris_tracker eph_tracker;
+
+#if defined(CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER)
+/* Barometer bias drift, tuned with tools/altitude_replay. */
+#define ALTITUDE_BIAS_DRIFT 0.01f
 
+static struct altitude_filter alt_filter;
+static bool baro_available;
+#endif
+
+#if defined(CONFIG_GNSS_SAMPLE_HEADING_FILTER)
+static struct heading_estimator heading_est;
+#endif
+
+#if defined(CONFIG_GNSS_SAMPLE_SV_HISTORY)
+BUILD_ASSERT(SV_HISTORY_MAX_SV == NRF_MODEM_GNSS_MAX_SATELLITES);
+
+/* Satellite history segment being filled, starting with a keyframe. */
+static struct sv_history_codec sv_hist_codec;
+static uint8_t sv_hist_segment[CONFIG_GNSS_SAMPLE_SV_HISTORY_SEGMENT_SIZE];
+static size_t sv_hist_len;
+static uint32_t sv_hist_epochs;
+#endif
+
+/* Uptime of the last fix (0 if none) and the satellites used in it. */
+static int64_t last_fix_uptime;
+static uint8_t last_sv_used;
+
+/* Uptime when the current acquisition and on-time started, 0 if none. */
+static int64_t acquisition_start;
+static int64_t on_since;
+
+/* 32-bit uptime when the modem went to sleep between periodic fixes. */
+static atomic_t modem_sleep_uptime;
+
+/* Scheduled navigation data download in progress, and GNSS priority over LTE. */
+static bool sched_download;
+static int64_t sched_download_start;
+static bool prio_mode;
+
+/* NMEA sentences do not wake the loop, they are drained with the next PVT. */
 static struct k_poll_event events[2] = {
     K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE,
                                     K_POLL_MODE_NOTIFY_ONLY,
                                     &pvt_data_sem, 0),
-    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+    K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_SIGNAL,
                                     K_POLL_MODE_NOTIFY_ONLY,
-                                    &nmea_queue, 0),
+                                    &wakeup_signal, 0),
 };
 
 /*
-Function : distance_calculate
+Function : reference_nav_get
 
 Description : 
-    Calculates the great-circle distance (in meters) between two GPS coordinates
-    using the Haversine formula.
+    Calculates the distance and bearing from the stored reference position to
+    the current GNSS fix, if set. The distance is ellipsoidal (WGS-84) with
+    CONFIG_GNSS_SAMPLE_DISTANCE_ELLIPSOIDAL, spherical otherwise.
 
 Parameter : 
-    double lat1 - Latitude of the first point (in degrees)
-    double lon1 - Longitude of the first point (in degrees)
-    double lat2 - Latitude of the second point (in degrees)
-    double lon2 - Longitude of the second point (in degrees)
+    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to current PVT data
+    struct geo_nav *nav                            - Distance and bearing output
 
 Return : 
-    double - Distance in meters between the two points
+    bool - true if a reference position is set and nav was filled in
 
 Example Call : 
-    double dist = distance_calculate(59.3293, 18.0686, 60.1695, 24.9354);
+    if (reference_nav_get(&last_pvt, &nav)) { ... }
 */
-static double distance_calculate(double lat1, double lon1,
-                                 double lat2, double lon2)
+static bool reference_nav_get(struct nrf_modem_gnss_pvt_data_frame *pvt_data,
+                              struct geo_nav *nav)
 {
-    double d_lat_rad = (lat2 - lat1) * DEG_TO_RAD;
-    double d_lon_rad = (lon2 - lon1) * DEG_TO_RAD;
-
-    double lat1_rad = lat1 * DEG_TO_RAD;
-    double lat2_rad = lat2 * DEG_TO_RAD;
+    if (!ref_used)
+    {
+        return false;
+    }
 
-    double a = pow(sin(d_lat_rad / 2), 2) +
-               pow(sin(d_lon_rad / 2), 2) *
-                   cos(lat1_rad) * cos(lat2_rad);
+    geo_nav_get(&ref_origin, pvt_data->latitude, pvt_data->longitude, nav);
 
-    double c = 2 * asin(sqrt(a));
+#if defined(CONFIG_GNSS_SAMPLE_DISTANCE_ELLIPSOIDAL)
+    double distance;
 
-    return EARTH_RADIUS_METERS * c;
+    (void)geo_wgs84_distance(&ref_wgs84, pvt_data->latitude, pvt_data->longitude, &distance);
+    nav->distance_m = (float)distance;
+#endif
+    return true;
 }
 
 /*
 Function : print_distance_from_reference
 
 Description : 
-    Calculates and logs the distance between the current GNSS fix and a stored
-    reference position, if set.
+    Logs the distance and bearing from the reference position to the current
+    GNSS fix.
 
 Parameter : 
-    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to current PVT data
+    const struct geo_nav *nav - Distance and bearing from the reference
 
 Return : 
     void
 
 Example Call : 
-    print_distance_from_reference(&last_pvt);
+    print_distance_from_reference(&nav);
 */
-static void print_distance_from_reference(struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+static void print_distance_from_reference(const struct geo_nav *nav)
 {
-    if (!ref_used)
-    {
-        return;
-    }
+    DISPLAY_INF("Distance from reference: %.01f, bearing %.01f deg\n\r",
+            (double)nav->distance_m, (double)nav->bearing_deg);
+}
+
+/*
+Function : gnss_reference_set
 
-    double distance = distance_calculate(pvt_data->latitude, pvt_data->longitude,
-                                         ref_latitude, ref_longitude);
+Description : 
+    Sets the reference position that the distance and bearing of each fix are
+    reported from.
 
-    LOG_INF("Distance from reference: %.01f\n\r", distance);
+Parameter : 
+    double latitude  - Reference latitude (in degrees)
+    double longitude - Reference longitude (in degrees)
+
+Return : 
+    void
+
+Example Call : 
+    gnss_reference_set(61.4937533, 23.7758897);
+*/
+void gnss_reference_set(double latitude, double longitude)
+{
+    geo_origin_set(&ref_origin, latitude, longitude);
+#if defined(CONFIG_GNSS_SAMPLE_DISTANCE_ELLIPSOIDAL)
+    geo_wgs84_origin_set(&ref_wgs84, latitude, longitude);
+#endif
+    ref_used = true;
 }
 
 /*
@@ -153,8 +282,7 @@ static void gnss_event_handler(int event)
         break;
 
     case NRF_MODEM_GNSS_EVT_NMEA:
-        nmea_data = k_malloc(sizeof(struct nrf_modem_gnss_nmea_data_frame));
-        if (nmea_data == NULL)
+        if (k_mem_slab_alloc(&nmea_slab, (void **)&nmea_data, K_NO_WAIT) != 0)
         {
             LOG_ERR("Failed to allocate memory for NMEA");
             break;
@@ -170,143 +298,881 @@ static void gnss_event_handler(int event)
 
         if (retval != 0)
         {
-            k_free(nmea_data);
+            k_mem_slab_free(&nmea_slab, nmea_data);
         }
         break;
+
+    case NRF_MODEM_GNSS_EVT_SLEEP_AFTER_FIX:
+    case NRF_MODEM_GNSS_EVT_SLEEP_AFTER_TIMEOUT:
+        atomic_set(&modem_sleep_uptime, (atomic_val_t)MAX(k_uptime_get_32(), 1U));
+        break;
+
     default:
         break;
     }
 }
 
 /*
-Function : print_satellite_stats
+Function : sv_summary_get
+
+Description : 
+    Summarizes the satellites in the GNSS PVT data: number tracked, used in fix
+    and unhealthy, and the CN0 range of the tracked satellites. Every slot in
+    use counts, also satellites the satellite table does not know.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+    struct gnss_sv_msg *summary                          - Summary output
+
+Return : 
+    void
+
+Example Call : 
+    sv_summary_get(&last_pvt, &summary);
+*/
+static void sv_summary_get(const struct nrf_modem_gnss_pvt_data_frame *pvt_data,
+                           struct gnss_sv_msg *summary)
+{
+    uint32_t cn0_sum = 0;
+
+    memset(summary, 0, sizeof(*summary));
+    summary->cn0_min = UINT16_MAX;
+
+    for (int i = 0; i < NRF_MODEM_GNSS_MAX_SATELLITES; ++i)
+    {
+        const struct nrf_modem_gnss_sv *sv = &pvt_data->sv[i];
+        /* Empty slots count as 0, without branching. */
+        uint8_t used = sv->sv > 0;
+
+        summary->tracked += used;
+        cn0_sum += used * sv->cn0;
+        summary->cn0_min = MIN(summary->cn0_min, used ? sv->cn0 : UINT16_MAX);
+        summary->cn0_max = MAX(summary->cn0_max, used * sv->cn0);
+        summary->in_fix += used & !!(sv->flags & NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX);
+        summary->unhealthy += used & !!(sv->flags & NRF_MODEM_GNSS_SV_FLAG_UNHEALTHY);
+    }
+
+    if (summary->tracked > 0)
+    {
+        summary->cn0_avg = cn0_sum / summary->tracked;
+    }
+    else
+    {
+        summary->cn0_min = 0;
+    }
+}
+
+/*
+Function : print_satellite_stats
+
+Description : 
+    Logs the number of satellites tracked, used in fix, and unhealthy.
+
+Parameter : 
+    const struct gnss_sv_msg *summary - Satellite summary of the PVT data
+
+Return : 
+    void
+
+Example Call : 
+    print_satellite_stats(&summary);
+*/
+static void print_satellite_stats(const struct gnss_sv_msg *summary)
+{
+    DISPLAY_INF("Tracking: %2d Using: %2d Unhealthy: %d",
+            summary->tracked, summary->in_fix, summary->unhealthy);
+}
+
+/*
+Function : pvt_timestamp_ms
+
+Description :
+    Converts the PVT date and time (UTC) to milliseconds since the Unix epoch.
+
+Parameter :
+    const struct nrf_modem_gnss_datetime *dt - PVT date and time
+
+Return :
+    int64_t - UTC timestamp in milliseconds
+
+Example Call :
+    int64_t ts = pvt_timestamp_ms(&pvt_data->datetime);
+*/
+static int64_t pvt_timestamp_ms(const struct nrf_modem_gnss_datetime *dt)
+{
+    return gnss_time_utc_ms(dt->year, dt->month, dt->day,
+                            dt->hour, dt->minute, dt->seconds, dt->ms);
+}
+
+/*
+Function : fix_confidence_get
+
+Description :
+    Scores the confidence of a fix from its DOP values, estimated accuracy,
+    satellites used and the CN0 spread of the tracked satellites.
+
+Parameter :
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+    const struct gnss_sv_msg *summary                    - Satellite summary
+
+Return :
+    uint8_t - Confidence, 0 to 100
+
+Example Call :
+    uint8_t confidence = fix_confidence_get(&last_pvt, &summary);
+*/
+static uint8_t fix_confidence_get(const struct nrf_modem_gnss_pvt_data_frame *pvt_data,
+                                  const struct gnss_sv_msg *summary)
+{
+    struct fix_quality_input input = {
+        .hdop = pvt_data->hdop,
+        .pdop = pvt_data->pdop,
+        .accuracy_m = pvt_data->accuracy,
+        .sv_used = summary->in_fix,
+        .cn0_min = summary->cn0_min,
+        .cn0_max = summary->cn0_max,
+    };
+
+    return fix_quality_score(&input);
+}
+
+/*
+Function : altitude_filter_update
+
+Description : 
+    Feeds the barometer reading of a PVT epoch and, when the fix is valid, the
+    GNSS altitude and vertical speed to the altitude filter. Does nothing
+    unless CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER is enabled.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+
+Return : 
+    void
+
+Example Call : 
+    altitude_filter_update(&last_pvt);
+*/
+static void altitude_filter_update(const struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+{
+#if defined(CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER)
+    int64_t now = k_uptime_get();
+    float pressure;
+
+    if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID)
+    {
+        altitude_update_gnss(&alt_filter, now, pvt_data->altitude,
+                             pvt_data->altitude_accuracy, pvt_data->vertical_speed,
+                             pvt_data->vertical_speed_accuracy);
+    }
+
+    if (baro_available && baro_read(&pressure) == 0)
+    {
+        altitude_update_baro(&alt_filter, now, pressure);
+    }
+#else
+    ARG_UNUSED(pvt_data);
+#endif
+}
+
+/*
+Function : heading_filter_update
+
+Description : 
+    Feeds a valid fix to the heading estimator. Does nothing unless
+    CONFIG_GNSS_SAMPLE_HEADING_FILTER is enabled.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to valid fix data
+
+Return : 
+    void
+
+Example Call : 
+    heading_filter_update(&last_pvt);
+*/
+static void heading_filter_update(const struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+{
+#if defined(CONFIG_GNSS_SAMPLE_HEADING_FILTER)
+    heading_update(&heading_est, k_uptime_get(), pvt_data->latitude, pvt_data->longitude,
+                   pvt_data->accuracy, pvt_data->speed, pvt_data->heading,
+                   pvt_data->heading_accuracy);
+#else
+    ARG_UNUSED(pvt_data);
+#endif
+}
+
+/*
+Function : satellite_history_update
+
+Description : 
+    Encodes the tracked satellites of a PVT epoch into the satellite history
+    segment. When the segment is full its size is logged against the raw
+    sv[] arrays it holds and the next segment starts with a keyframe, so
+    every segment can be stored and decoded on its own. Does nothing unless
+    CONFIG_GNSS_SAMPLE_SV_HISTORY is enabled.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+
+Return : 
+    void
+
+Example Call : 
+    satellite_history_update(&last_pvt);
+*/
+static void satellite_history_update(const struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+{
+#if defined(CONFIG_GNSS_SAMPLE_SV_HISTORY)
+    struct sv_history_epoch epoch = {.time_ms = k_uptime_get()};
+    uint8_t record[SV_HISTORY_RECORD_MAX_SIZE];
+    int len;
+
+    for (int i = 0; i < NRF_MODEM_GNSS_MAX_SATELLITES; ++i)
+    {
+        const struct nrf_modem_gnss_sv *sv = &pvt_data->sv[i];
+
+        /* Every slot in use, also PRNs the satellite table does not know. */
+        if (sv->sv > 0)
+        {
+            epoch.sv[epoch.count++] = (struct sv_history_sv){
+                .sv = sv->sv,
+                .signal = sv->signal,
+                .flags = sv->flags,
+                .cn0 = sv->cn0,
+                .elevation = sv->elevation,
+                .azimuth = sv->azimuth,
+            };
+        }
+    }
+
+    len = sv_history_encode(&sv_hist_codec, &epoch, record, sizeof(record));
+    if (len > 0 && sv_hist_len + len > sizeof(sv_hist_segment))
+    {
+        LOG_INF("SV history segment: %u epochs in %u bytes (%u bytes raw)", sv_hist_epochs,
+                (uint32_t)sv_hist_len, (uint32_t)(sv_hist_epochs * sizeof(pvt_data->sv)));
+
+        sv_hist_len = 0;
+        sv_hist_epochs = 0;
+        sv_history_init(&sv_hist_codec, CONFIG_GNSS_SAMPLE_SV_HISTORY_KEYFRAME_INTERVAL);
+        len = sv_history_encode(&sv_hist_codec, &epoch, record, sizeof(record));
+    }
+
+    if (len > 0)
+    {
+        memcpy(&sv_hist_segment[sv_hist_len], record, len);
+        sv_hist_len += len;
+        sv_hist_epochs++;
+    }
+#else
+    ARG_UNUSED(pvt_data);
+#endif
+}
+
+/*
+Function : heading_filtered_get
+
+Description : 
+    Returns the estimated heading and its accuracy, or the PVT heading until
+    the estimator has one or without CONFIG_GNSS_SAMPLE_HEADING_FILTER.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to valid fix data
+    float *accuracy                                      - Heading accuracy output in degrees
+
+Return : 
+    float - Heading in degrees
+
+Example Call : 
+    float heading = heading_filtered_get(&last_pvt, &accuracy);
+*/
+static float heading_filtered_get(const struct nrf_modem_gnss_pvt_data_frame *pvt_data,
+                                  float *accuracy)
+{
+#if defined(CONFIG_GNSS_SAMPLE_HEADING_FILTER)
+    float heading = heading_get(&heading_est);
+
+    if (!isnan(heading))
+    {
+        *accuracy = heading_accuracy_get(&heading_est);
+        return heading;
+    }
+#endif
+    *accuracy = pvt_data->heading_accuracy;
+    return pvt_data->heading;
+}
+
+/*
+Function : publish_pvt
+
+Description : 
+    Publishes the satellite summary and status flags of a PVT notification, and
+    the fix when it is valid, on the GNSS zbus channels.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+    const struct gnss_sv_msg *summary                    - Satellite summary
+    uint8_t confidence                                   - Fix confidence, 0 to 100
+
+Return : 
+    void
+
+Example Call : 
+    publish_pvt(&last_pvt, &summary, confidence);
+*/
+static void publish_pvt(const struct nrf_modem_gnss_pvt_data_frame *pvt_data,
+                        const struct gnss_sv_msg *summary, uint8_t confidence)
+{
+    struct gnss_status_msg status = {
+        .flags = pvt_data->flags,
+    };
+
+    (void)gnss_bus_publish(&gnss_status_chan, &status);
+    (void)gnss_bus_publish(&gnss_sv_chan, summary);
+
+    if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID)
+    {
+        float heading_accuracy;
+        float heading = heading_filtered_get(pvt_data, &heading_accuracy);
+        struct gnss_fix_msg fix = {
+            .latitude = pvt_data->latitude,
+            .longitude = pvt_data->longitude,
+            .altitude = pvt_data->altitude,
+            .accuracy = pvt_data->accuracy,
+            .speed = pvt_data->speed,
+            .heading = heading,
+            .heading_accuracy = heading_accuracy,
+#if defined(CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER)
+            .altitude_filtered = altitude_get(&alt_filter),
+            .climb_rate = altitude_climb_rate_get(&alt_filter),
+#else
+            .altitude_filtered = pvt_data->altitude,
+            .climb_rate = pvt_data->vertical_speed,
+#endif
+            .timestamp_ms = pvt_timestamp_ms(&pvt_data->datetime),
+            .confidence = confidence,
+        };
+
+        (void)gnss_bus_publish(&gnss_fix_chan, &fix);
+    }
+}
+
+/* Rate-limited reporters for the PVT status flags. */
+struct flag_report
+{
+    uint8_t flag;
+    struct event_report report;
+};
+
+static struct flag_report flag_reports[] = {
+    {NRF_MODEM_GNSS_PVT_FLAG_DEADLINE_MISSED,
+     EVENT_REPORT_INIT("GNSS operation blocked by LTE", true,
+                       METRICS_LTE_BLOCKED_EVENTS, METRICS_LTE_BLOCKED_EPOCHS)},
+    {NRF_MODEM_GNSS_PVT_FLAG_NOT_ENOUGH_WINDOW_TIME,
+     EVENT_REPORT_INIT("Insufficient GNSS time windows", true,
+                       METRICS_WINDOW_TIME_EVENTS, METRICS_WINDOW_TIME_EPOCHS)},
+    {NRF_MODEM_GNSS_PVT_FLAG_SLEEP_BETWEEN_PVT,
+     EVENT_REPORT_INIT("Sleep period(s) between PVT notifications", false,
+                       METRICS_SLEEP_EVENTS, METRICS_SLEEP_EPOCHS)},
+    {NRF_MODEM_GNSS_PVT_FLAG_SCHED_DOWNLOAD,
+     EVENT_REPORT_INIT("Scheduled navigation data download", false,
+                       METRICS_SCHED_DOWNLOAD_EVENTS, METRICS_SCHED_DOWNLOAD_EPOCHS)},
+};
+
+/*
+Function : print_flags
+
+Description : 
+    Reports GNSS flags such as LTE blocking, scheduled download, or sleep
+    conditions. Each condition is logged when it starts and ends, with periodic
+    epoch counts in between, instead of on every epoch it persists.
+
+Parameter : 
+    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+
+Return : 
+    void
+
+Example Call : 
+    print_flags(&last_pvt);
+*/
+static void print_flags(struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+{
+    int64_t now = k_uptime_get();
+
+    for (size_t i = 0; i < ARRAY_SIZE(flag_reports); i++)
+    {
+        event_report_update(&flag_reports[i].report,
+                            pvt_data->flags & flag_reports[i].flag, now);
+    }
+}
+
+/*
+Function : print_fix_data
+
+Description : 
+    Logs all available GNSS fix data including position, speed, heading, DOP values,
+    and UTC timestamp.
+
+Parameter : 
+    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to valid fix data
+    uint8_t confidence                             - Fix confidence, 0 to 100
+
+Return : 
+    void
+
+Example Call : 
+    print_fix_data(&last_pvt, confidence);
+*/
+static void print_fix_data(struct nrf_modem_gnss_pvt_data_frame *pvt_data, uint8_t confidence)
+{
+    DISPLAY_INF("Latitude:          %.06f", pvt_data->latitude);
+    DISPLAY_INF("Longitude:         %.06f", pvt_data->longitude);
+    DISPLAY_INF("Accuracy:          %.01f m", (double)pvt_data->accuracy);
+    DISPLAY_INF("Altitude:          %.01f m", (double)pvt_data->altitude);
+    DISPLAY_INF("Altitude accuracy: %.01f m", (double)pvt_data->altitude_accuracy);
+    DISPLAY_INF("Speed:             %.01f m/s", (double)pvt_data->speed);
+    DISPLAY_INF("Speed accuracy:    %.01f m/s", (double)pvt_data->speed_accuracy);
+    DISPLAY_INF("V. speed:          %.01f m/s", (double)pvt_data->vertical_speed);
+    DISPLAY_INF("V. speed accuracy: %.01f m/s", (double)pvt_data->vertical_speed_accuracy);
+#if defined(CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER)
+    DISPLAY_INF("Altitude filtered: %.01f m, climb %.02f m/s",
+                (double)altitude_get(&alt_filter), (double)altitude_climb_rate_get(&alt_filter));
+#endif
+    DISPLAY_INF("Heading:           %.01f deg", (double)pvt_data->heading);
+    DISPLAY_INF("Heading accuracy:  %.01f deg", (double)pvt_data->heading_accuracy);
+#if defined(CONFIG_GNSS_SAMPLE_HEADING_FILTER)
+    float heading_accuracy;
+    float heading = heading_filtered_get(pvt_data, &heading_accuracy);
+
+    DISPLAY_INF("Heading filtered:  %.01f deg, accuracy %.01f deg",
+                (double)heading, (double)heading_accuracy);
+#endif
+    DISPLAY_INF("Date:              %04u-%02u-%02u",
+                pvt_data->datetime.year,
+                pvt_data->datetime.month,
+                pvt_data->datetime.day);
+    DISPLAY_INF("Time (UTC):        %02u:%02u:%02u.%03u",
+                pvt_data->datetime.hour,
+                pvt_data->datetime.minute,
+                pvt_data->datetime.seconds,
+                pvt_data->datetime.ms);
+
+    int64_t gps_ms = gnss_time_utc_to_gps_ms(pvt_timestamp_ms(&pvt_data->datetime));
+    uint16_t week;
+    uint32_t tow_ms;
+
+    gnss_time_gps_week(gps_ms, &week, &tow_ms);
+    DISPLAY_INF("GPS week/TOW:      %u / %u.%03u s", week, tow_ms / 1000, tow_ms % 1000);
+    DISPLAY_INF("PDOP:              %.01f", (double)pvt_data->pdop);
+    DISPLAY_INF("HDOP:              %.01f", (double)pvt_data->hdop);
+    DISPLAY_INF("VDOP:              %.01f", (double)pvt_data->vdop);
+    DISPLAY_INF("TDOP:              %.01f", (double)pvt_data->tdop);
+    DISPLAY_INF("Confidence:        %u %%\n", confidence);
+}
+
+/*
+Function : use_case_get
+
+Description : 
+    Builds the requested GNSS use case: low accuracy fixes if allowed, and
+    scheduled downloads enabled while ephemerides are being refreshed.
+
+Parameter : 
+    void
+
+Return : 
+    uint8_t - NRF_MODEM_GNSS_USE_CASE_* bits
+
+Example Call : 
+    if (use_case_get() != use_case_applied) { ... }
+*/
+static uint8_t use_case_get(void)
+{
+    /* This use case flag should always be set. */
+    uint8_t use_case = NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START;
+
+    if (IS_ENABLED(CONFIG_GNSS_SAMPLE_MODE_PERIODIC) &&
+        !IS_ENABLED(CONFIG_GNSS_SAMPLE_ASSISTANCE_NONE) && !ephemeris_refresh)
+    {
+        /* Disable GNSS scheduled downloads when assistance is used. */
+        use_case |= NRF_MODEM_GNSS_USE_CASE_SCHED_DOWNLOAD_DISABLE;
+    }
+
+    if (low_accuracy)
+    {
+        use_case |= NRF_MODEM_GNSS_USE_CASE_LOW_ACCURACY;
+    }
+
+    return use_case;
+}
+
+/*
+Function : use_case_set
+
+Description : 
+    Configures the requested GNSS use case. Only possible while GNSS is
+    stopped; on failure the previous use case stays in effect and is retried
+    on the next start.
+
+Parameter : 
+    void
+
+Return : 
+    void
+
+Example Call : 
+    use_case_set();
+*/
+static void use_case_set(void)
+{
+    uint8_t use_case = use_case_get();
+
+    if (nrf_modem_gnss_use_case_set(use_case) != 0)
+    {
+        LOG_WRN("Failed to set GNSS use case");
+        return;
+    }
+    use_case_applied = use_case;
+}
+
+/*
+Function : prio_mode_set
+
+Description : 
+    Enables or disables GNSS priority over LTE idle mode operations (paging,
+    TAU) on the modem.
+
+Parameter : 
+    bool enable - true to give GNSS priority
+
+Return : 
+    void
+
+Example Call : 
+    prio_mode_set(false);
+*/
+static void prio_mode_set(bool enable)
+{
+    if (enable == prio_mode)
+    {
+        return;
+    }
+
+    int err = enable ? nrf_modem_gnss_prio_mode_enable() : nrf_modem_gnss_prio_mode_disable();
+
+    if (err != 0)
+    {
+        LOG_WRN("Failed to %s GNSS priority mode, error: %d", enable ? "enable" : "disable", err);
+        return;
+    }
+    prio_mode = enable;
+}
+
+/*
+Function : sched_download_update
+
+Description : 
+    Tracks scheduled navigation data downloads. While a download is in
+    progress GNSS is given priority over LTE, for at most
+    CONFIG_GNSS_SAMPLE_SCHED_DOWNLOAD_TIMEOUT seconds, so the broadcast
+    ephemerides are not lost to LTE activity.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+
+Return : 
+    bool - true if a download completed with this notification
+
+Example Call : 
+    bool downloaded = sched_download_update(&last_pvt);
+*/
+static bool sched_download_update(const struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+{
+    bool completed = false;
+    bool active = pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_SCHED_DOWNLOAD;
+    int64_t now = k_uptime_get();
+
+    if (active && !sched_download)
+    {
+        sched_download_start = now;
+        if (IS_ENABLED(CONFIG_GNSS_SAMPLE_SCHED_DOWNLOAD_PRIORITY))
+        {
+            prio_mode_set(true);
+        }
+    }
+    else if (!active && sched_download)
+    {
+        LOG_DBG("Scheduled download took %u ms", (uint32_t)(now - sched_download_start));
+        prio_mode_set(false);
+        completed = true;
+    }
+    else if (active && prio_mode &&
+             now - sched_download_start >= CONFIG_GNSS_SAMPLE_SCHED_DOWNLOAD_TIMEOUT *
+                                                MSEC_PER_SEC)
+    {
+        LOG_WRN("Scheduled download still in progress, releasing GNSS priority");
+        prio_mode_set(false);
+    }
+
+    sched_download = active;
+
+    return completed;
+}
+
+/*
+Function : gnss_sched_download_active
+
+Description : 
+    Returns whether GNSS is downloading navigation data from the satellite
+    broadcast. Stopping GNSS or LTE traffic during a download loses the data
+    and lengthens the following fixes, so callers should defer both until the
+    download completes, up to CONFIG_GNSS_SAMPLE_SCHED_DOWNLOAD_TIMEOUT seconds.
+
+Parameter : 
+    void
+
+Return : 
+    bool - true while a scheduled download is in progress
+
+Example Call : 
+    if (!gnss_sched_download_active()) { send_data(); }
+*/
+bool gnss_sched_download_active(void)
+{
+    return sched_download;
+}
+
+/*
+Function : ephemeris_update
+
+Description : 
+    Records the satellites used in a fix in the ephemeris tracker.
+
+Parameter : 
+    const struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+    bool downloaded - true if a scheduled download just completed, so the
+                      ephemerides of the satellites in use are fresh
+
+Return : 
+    void
+
+Example Call : 
+    ephemeris_update(&last_pvt, downloaded);
+*/
+static void ephemeris_update(const struct nrf_modem_gnss_pvt_data_frame *pvt_data,
+                             bool downloaded)
+{
+    uint32_t now_s = (uint32_t)(k_uptime_get() / MSEC_PER_SEC);
+
+    for (int i = 0; i < NRF_MODEM_GNSS_MAX_SATELLITES; ++i)
+    {
+        if (pvt_data->sv[i].flags & NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX)
+        {
+            ephemeris_sv_used(&eph_tracker, pvt_data->sv[i].sv, pvt_data->sv[i].signal, now_s,
+                              downloaded);
+        }
+    }
+}
+
+#if defined(CONFIG_GNSS_SAMPLE_EPHEMERIS_REFRESH)
+/*
+Function : ephemeris_refresh_update
+
+Description : 
+    Predicts from the ephemeris ages whether one of the next two periodic
+    fixes would be a cold start, and if so enables scheduled downloads so the
+    modem decodes fresh ephemerides while the satellites are still tracked.
+    Scheduled downloads are disabled again once the prediction is clear. The
+    changed use case is applied by the state machine, which does not restart
+    GNSS under a running download.
+
+Parameter : 
+    void
+
+Return : 
+    void
+
+Example Call : 
+    ephemeris_refresh_update();
+*/
+static void ephemeris_refresh_update(void)
+{
+    uint32_t now_s = (uint32_t)(k_uptime_get() / MSEC_PER_SEC);
+    uint32_t expiry = ephemeris_expiry(&eph_tracker, CONFIG_GNSS_SAMPLE_EPHEMERIS_MIN_SV);
+    bool needed = expiry < now_s + 2 * CONFIG_GNSS_SAMPLE_PERIODIC_INTERVAL;
+
+    if (needed == ephemeris_refresh)
+    {
+        return;
+    }
+
+    ephemeris_refresh = needed;
+    if (needed)
+    {
+        LOG_INF("Cold start predicted in %d s, refreshing ephemerides",
+                (int)(expiry - now_s));
+        metrics_inc(METRICS_EPHEMERIS_REFRESHES);
+    }
+
+    gnss_sm_request_use_case();
+}
+#endif /* CONFIG_GNSS_SAMPLE_EPHEMERIS_REFRESH */
+
+/*
+Function : modem_sleep_take
+
+Description : 
+    Takes the time the modem went to sleep between periodic fixes, recorded by
+    the event handler as 32-bit uptime, and rebases it on the 64-bit uptime.
+
+Parameter : 
+    int64_t now - Current uptime in milliseconds
+
+Return : 
+    int64_t - Uptime when the modem went to sleep, 0 if it has not slept
+
+Example Call : 
+    int64_t slept = modem_sleep_take(now);
+*/
+static int64_t modem_sleep_take(int64_t now)
+{
+    uint32_t slept = (uint32_t)atomic_clear(&modem_sleep_uptime);
+
+    if (slept == 0)
+    {
+        return 0;
+    }
+
+    return now - (uint32_t)((uint32_t)now - slept);
+}
+
+/*
+Function : on_time_end
 
 Description : 
-    Logs the number of satellites tracked, used in fix, and unhealthy
-    from the GNSS PVT data.
+    Ends the current GNSS on-time period, adds it to the on-time counter of
+    the configured use case and ends it in the energy account.
 
 Parameter : 
-    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+    int64_t now - Uptime in milliseconds when GNSS stopped or went to sleep
 
 Return : 
     void
 
 Example Call : 
-    print_satellite_stats(&last_pvt);
+    on_time_end(k_uptime_get());
 */
-static void print_satellite_stats(struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+static void on_time_end(int64_t now)
 {
-    uint8_t tracked = 0;
-    uint8_t in_fix = 0;
-    uint8_t unhealthy = 0;
-
-    for (int i = 0; i < NRF_MODEM_GNSS_MAX_SATELLITES; ++i)
+    if (on_since == 0)
     {
-        if (pvt_data->sv[i].sv > 0)
-        {
-            tracked++;
-
-            if (pvt_data->sv[i].flags & NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX)
-            {
-                in_fix++;
-            }
-
-            if (pvt_data->sv[i].flags & NRF_MODEM_GNSS_SV_FLAG_UNHEALTHY)
-            {
-                unhealthy++;
-            }
-        }
+        return;
     }
 
-    LOG_INF("Tracking: %2d Using: %2d Unhealthy: %d", tracked, in_fix, unhealthy);
+    metrics_add(LOW_ACCURACY_APPLIED ? METRICS_ON_TIME_LOW_MS : METRICS_ON_TIME_NORMAL_MS,
+                (uint32_t)(now - on_since));
+    energy_monitor_gnss_off(now);
+    on_since = 0;
+    acquisition_start = 0;
 }
 
 /*
-Function : print_flags
+Function : acquisition_update
 
 Description : 
-    Logs debug information about GNSS flags such as LTE blocking, scheduled download,
-    or sleep conditions.
+    Tracks GNSS on-time and time to first fix for every PVT notification. In
+    periodic mode the modem sleeps and wakes on its own, so a notification after
+    a sleep event starts a new acquisition.
 
 Parameter : 
-    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to PVT data
+    bool fix - true if the notification has a valid fix
 
 Return : 
     void
 
 Example Call : 
-    print_flags(&last_pvt);
+    acquisition_update(last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID);
 */
-static void print_flags(struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+static void acquisition_update(bool fix)
 {
-    if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_DEADLINE_MISSED)
-    {
-        LOG_WRN("GNSS operation blocked by LTE\n");
-    }
-    if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_NOT_ENOUGH_WINDOW_TIME)
+    int64_t now = k_uptime_get();
+    int64_t slept = modem_sleep_take(now);
+
+    if (slept != 0)
     {
-        LOG_WRN("Insufficient GNSS time windows\n");
+        on_time_end(slept);
     }
-    if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_SLEEP_BETWEEN_PVT)
+
+    if (on_since == 0 && gnss_running)
     {
-        LOG_INF("Sleep period(s) between PVT notifications\n");
+        on_since = now;
+        acquisition_start = now;
+        energy_monitor_gnss_on(on_since);
     }
-    if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_SCHED_DOWNLOAD)
+
+    if (fix && acquisition_start != 0)
     {
-        LOG_INF("Scheduled navigation data download\n");
+        uint32_t ttff = (uint32_t)(now - acquisition_start);
+
+        if (LOW_ACCURACY_APPLIED)
+        {
+            metrics_inc(METRICS_TTFF_LOW_COUNT);
+            metrics_add(METRICS_TTFF_LOW_MS, ttff);
+        }
+        else
+        {
+            metrics_inc(METRICS_TTFF_NORMAL_COUNT);
+            metrics_add(METRICS_TTFF_NORMAL_MS, ttff);
+        }
+
+        LOG_INF("TTFF: %u ms (%s accuracy)", ttff, LOW_ACCURACY_APPLIED ? "low" : "normal");
+        acquisition_start = 0;
     }
 }
 
+#if defined(CONFIG_GNSS_SAMPLE_LOW_ACCURACY_AUTO)
 /*
-Function : print_fix_data
+Function : low_accuracy_update
 
 Description : 
-    Logs all available GNSS fix data including position, speed, heading, DOP values,
-    and UTC timestamp.
+    Allows low accuracy fixes while the position is within
+    CONFIG_GNSS_SAMPLE_LOW_ACCURACY_RADIUS of the reference position, where a
+    coarse position suffices, and requires normal accuracy again once it is
+    further than the radius plus CONFIG_GNSS_SAMPLE_LOW_ACCURACY_HYSTERESIS.
 
 Parameter : 
-    struct nrf_modem_gnss_pvt_data_frame *pvt_data - Pointer to valid fix data
+    const struct geo_nav *nav - Distance from the reference
 
 Return : 
     void
 
 Example Call : 
-    print_fix_data(&last_pvt);
+    low_accuracy_update(&nav);
 */
-static void print_fix_data(struct nrf_modem_gnss_pvt_data_frame *pvt_data)
+static void low_accuracy_update(const struct geo_nav *nav)
 {
-    LOG_INF("Latitude:          %.06f", pvt_data->latitude);
-    LOG_INF("Longitude:         %.06f", pvt_data->longitude);
-    LOG_INF("Accuracy:          %.01f m", (double)pvt_data->accuracy);
-    LOG_INF("Altitude:          %.01f m", (double)pvt_data->altitude);
-    LOG_INF("Altitude accuracy: %.01f m", (double)pvt_data->altitude_accuracy);
-    LOG_INF("Speed:             %.01f m/s", (double)pvt_data->speed);
-    LOG_INF("Speed accuracy:    %.01f m/s", (double)pvt_data->speed_accuracy);
-    LOG_INF("V. speed:          %.01f m/s", (double)pvt_data->vertical_speed);
-    LOG_INF("V. speed accuracy: %.01f m/s", (double)pvt_data->vertical_speed_accuracy);
-    LOG_INF("Heading:           %.01f deg", (double)pvt_data->heading);
-    LOG_INF("Heading accuracy:  %.01f deg", (double)pvt_data->heading_accuracy);
-    LOG_INF("Date:              %04u-%02u-%02u",
-            pvt_data->datetime.year,
-            pvt_data->datetime.month,
-            pvt_data->datetime.day);
-    LOG_INF("Time (UTC):        %02u:%02u:%02u.%03u",
-            pvt_data->datetime.hour,
-            pvt_data->datetime.minute,
-            pvt_data->datetime.seconds,
-            pvt_data->datetime.ms);
-    LOG_INF("PDOP:              %.01f", (double)pvt_data->pdop);
-    LOG_INF("HDOP:              %.01f", (double)pvt_data->hdop);
-    LOG_INF("VDOP:              %.01f", (double)pvt_data->vdop);
-    LOG_INF("TDOP:              %.01f\n", (double)pvt_data->tdop);
+    if (low_accuracy)
+    {
+        if (nav->distance_m > CONFIG_GNSS_SAMPLE_LOW_ACCURACY_RADIUS +
+                                  CONFIG_GNSS_SAMPLE_LOW_ACCURACY_HYSTERESIS)
+        {
+            (void)gnss_low_accuracy_set(false);
+        }
+    }
+    else if (nav->distance_m < CONFIG_GNSS_SAMPLE_LOW_ACCURACY_RADIUS)
+    {
+        (void)gnss_low_accuracy_set(true);
+    }
 }
+#endif /* CONFIG_GNSS_SAMPLE_LOW_ACCURACY_AUTO */
 
 /*
-Function : gnss_init_and_start
+Function : gnss_init
 
 Description : 
-    Initializes the GNSS module by configuring use cases, enabling NMEA output,
-    setting power modes, and starting GNSS tracking.
+    Initializes the GNSS module by activating the GNSS functional mode, configuring
+    use cases, enabling NMEA output and setting power modes. Does not start GNSS.
 
 Parameter : 
     void
@@ -315,11 +1181,11 @@ Return :
     int - 0 on success, -1 on failure
 
 Example Call : 
-    if (gnss_init_and_start() != 0) {
+    if (gnss_init() != 0) {
         LOG_ERR("GNSS failed to initialize");
     }
 */
-int gnss_init_and_start(void)
+int gnss_init(void)
 {
     if (lte_lc_func_mode_set(LTE_LC_FUNC_MODE_ACTIVATE_GNSS) != 0)
     {
@@ -333,12 +1199,18 @@ int gnss_init_and_start(void)
         return -1;
     }
 
-    /* Enable all supported NMEA messages. */
-    uint16_t nmea_mask = NRF_MODEM_GNSS_NMEA_RMC_MASK |
-                         NRF_MODEM_GNSS_NMEA_GGA_MASK |
-                         NRF_MODEM_GNSS_NMEA_GLL_MASK |
-                         NRF_MODEM_GNSS_NMEA_GSA_MASK |
-                         NRF_MODEM_GNSS_NMEA_GSV_MASK;
+    /* Enable all supported NMEA messages, or none to save a modem interrupt
+     * per sentence. */
+    uint16_t nmea_mask = 0;
+
+    if (IS_ENABLED(CONFIG_GNSS_SAMPLE_NMEA))
+    {
+        nmea_mask = NRF_MODEM_GNSS_NMEA_RMC_MASK |
+                    NRF_MODEM_GNSS_NMEA_GGA_MASK |
+                    NRF_MODEM_GNSS_NMEA_GLL_MASK |
+                    NRF_MODEM_GNSS_NMEA_GSA_MASK |
+                    NRF_MODEM_GNSS_NMEA_GSV_MASK;
+    }
 
     int err = nrf_modem_gnss_nmea_mask_set(nmea_mask);
 
@@ -354,25 +1226,38 @@ int gnss_init_and_start(void)
         LOG_WRN("Failed to enable custom QZSS NMEA mode");
     }
 
-    /* This use case flag should always be set. */
-    uint8_t use_case = NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START;
+    use_case_set();
 
-    if (IS_ENABLED(CONFIG_GNSS_SAMPLE_MODE_PERIODIC) &&
-        !IS_ENABLED(CONFIG_GNSS_SAMPLE_ASSISTANCE_NONE))
+    /* Keep the ephemeris history over recoveries. */
+    if (eph_tracker.validity_s == 0)
     {
-        /* Disable GNSS scheduled downloads when assistance is used. */
-        use_case |= NRF_MODEM_GNSS_USE_CASE_SCHED_DOWNLOAD_DISABLE;
+        ephemeris_init(&eph_tracker, CONFIG_GNSS_SAMPLE_EPHEMERIS_VALIDITY);
     }
 
-    if (IS_ENABLED(CONFIG_GNSS_SAMPLE_LOW_ACCURACY))
+#if defined(CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER)
+    /* The filter restarts itself after a gap, keep it over recoveries. */
+    if (alt_filter.accel_noise == 0.0f)
     {
-        use_case |= NRF_MODEM_GNSS_USE_CASE_LOW_ACCURACY;
+        altitude_init(&alt_filter, CONFIG_GNSS_SAMPLE_ALTITUDE_ACCEL_NOISE / 100.0f,
+                      ALTITUDE_BIAS_DRIFT);
+        baro_available = (baro_init() == 0);
+    }
+#endif
+
+#if defined(CONFIG_GNSS_SAMPLE_HEADING_FILTER)
+    if (heading_est.fast_speed == 0.0f)
+    {
+        heading_init(&heading_est, CONFIG_GNSS_SAMPLE_HEADING_FAST_SPEED / 100.0f);
     }
+#endif
 
-    if (nrf_modem_gnss_use_case_set(use_case) != 0)
+#if defined(CONFIG_GNSS_SAMPLE_SV_HISTORY)
+    /* Keep the segment being filled over recoveries. */
+    if (sv_hist_codec.keyframe_interval == 0)
     {
-        LOG_WRN("Failed to set GNSS use case");
+        sv_history_init(&sv_hist_codec, CONFIG_GNSS_SAMPLE_SV_HISTORY_KEYFRAME_INTERVAL);
     }
+#endif
 
 #if defined(CONFIG_NRF_CLOUD_AGNSS_ELEVATION_MASK)
     if (nrf_modem_gnss_elevation_threshold_set(CONFIG_NRF_CLOUD_AGNSS_ELEVATION_MASK) != 0)
@@ -421,34 +1306,218 @@ int gnss_init_and_start(void)
         return -1;
     }
 
+    return 0;
+}
+
+/*
+Function : gnss_start
+
+Description : 
+    Starts GNSS with the configuration applied by gnss_init(). Does nothing if
+    GNSS is already running.
+
+Parameter : 
+    void
+
+Return : 
+    int - 0 on success, -1 on failure
+
+Example Call : 
+    gnss_start();
+*/
+int gnss_start(void)
+{
+    if (gnss_running)
+    {
+        return 0;
+    }
+
+    if (use_case_get() != use_case_applied)
+    {
+        use_case_set();
+    }
+
     if (nrf_modem_gnss_start() != 0)
     {
         LOG_ERR("Failed to start GNSS");
         return -1;
     }
-    fix_timestamp = k_uptime_get();
+    gnss_running = true;
+    (void)atomic_clear(&modem_sleep_uptime);
+    on_since = k_uptime_get();
+    acquisition_start = on_since;
+    fix_timestamp = on_since;
+    energy_monitor_gnss_on(on_since);
+    return 0;
+}
+
+/*
+Function : gnss_stop
+
+Description : 
+    Stops GNSS if it is running. The configuration is kept, so GNSS can be
+    restarted with gnss_start().
+
+Parameter : 
+    void
+
+Return : 
+    int - 0 on success, -1 on failure
+
+Example Call : 
+    gnss_stop();
+*/
+int gnss_stop(void)
+{
+    if (!gnss_running)
+    {
+        return 0;
+    }
+
+    /* A failed stop usually means the modem already stopped GNSS. */
+    gnss_running = false;
+    int64_t now = k_uptime_get();
+    int64_t slept = modem_sleep_take(now);
+
+    on_time_end(slept != 0 ? slept : now);
+
+    if (sched_download)
+    {
+        LOG_WRN("GNSS stopped during a scheduled download");
+        metrics_inc(METRICS_SCHED_DOWNLOAD_INTERRUPTED);
+        sched_download = false;
+    }
+    /* Priority mode ends with GNSS. */
+    prio_mode = false;
+
+    if (nrf_modem_gnss_stop() != 0)
+    {
+        LOG_ERR("Failed to stop GNSS");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+Function : gnss_low_accuracy_set
+
+Description : 
+    Allows or disallows low accuracy fixes at runtime. The use case can only be
+    changed while GNSS is stopped, so the state machine is asked to apply it;
+    it restarts running GNSS (a hot start) once no scheduled download is in
+    progress, or applies it with the next start.
+
+Parameter : 
+    bool enable - true to allow low accuracy fixes
+
+Return : 
+    int - Always returns 0
+
+Example Call : 
+    gnss_low_accuracy_set(true);
+*/
+int gnss_low_accuracy_set(bool enable)
+{
+    if (enable == low_accuracy)
+    {
+        return 0;
+    }
+
+    low_accuracy = enable;
+    metrics_inc(METRICS_USE_CASE_SWITCHES);
+    LOG_INF("Switching to %s accuracy", enable ? "low" : "normal");
+
+    gnss_sm_request_use_case();
     return 0;
 }
 
+/*
+Function : gnss_ttff_features_get
+
+Description : 
+    Returns the TTFF model features of an acquisition started at a given
+    uptime: time since the last fix, satellites with a usable ephemeris at
+    that time and satellites used in the last fix.
+
+Parameter : 
+    struct ttff_features *features - Features output
+    int64_t start                  - Acquisition start in uptime milliseconds
+
+Return : 
+    void
+
+Example Call : 
+    gnss_ttff_features_get(&features, k_uptime_get());
+*/
+void gnss_ttff_features_get(struct ttff_features *features, int64_t start)
+{
+    features->since_fix_s = TTFF_NO_FIX;
+    if (last_fix_uptime != 0 && start >= last_fix_uptime)
+    {
+        features->since_fix_s = (uint32_t)((start - last_fix_uptime) / MSEC_PER_SEC);
+    }
+
+    features->eph_valid = ephemeris_valid_count(&eph_tracker,
+                                                (uint32_t)(start / MSEC_PER_SEC));
+    features->sv_used = last_sv_used;
+}
+
+/*
+Function : gnss_init_and_start
+
+Description : 
+    Initializes the GNSS module and starts GNSS tracking.
+
+Parameter : 
+    void
+
+Return : 
+    int - 0 on success, -1 on failure
+
+Example Call : 
+    if (gnss_init_and_start() != 0) {
+        LOG_ERR("GNSS failed to initialize");
+    }
+*/
+int gnss_init_and_start(void)
+{
+    if (gnss_init() != 0)
+    {
+        return -1;
+    }
+
+    return gnss_start();
+}
+
 /*
 Function : refresh_display
 
 Description : 
     Clears the previous terminal output to refresh the printed GNSS data.
-    Uses ANSI escape codes to move and clear lines.
+    Uses ANSI escape codes to move and clear the lines counted while the
+    previous epoch was printed. Only resets the count unless
+    CONFIG_GNSS_SAMPLE_TERMINAL_REFRESH is enabled.
 
 Parameter : 
-    bool has_fix - Indicates if a GNSS fix is currently available
+    void
 
 Return : 
     void
 
 Example Call : 
-    refresh_display(last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID);
+    refresh_display();
 */
-static void refresh_display(bool has_fix)
+static void refresh_display(void)
 {
-    int lines_to_clear = has_fix ? 20 : 4;
+    int lines_to_clear = display_lines;
+
+    display_lines = 0;
+
+    /* Raw terminal output would corrupt a binary (dictionary) log stream. */
+    if (!IS_ENABLED(CONFIG_GNSS_SAMPLE_TERMINAL_REFRESH) || lines_to_clear == 0)
+    {
+        return;
+    }
 
     // Move up the number of lines to refresh
     printf("\033[%dA", lines_to_clear);
@@ -468,49 +1537,144 @@ static void refresh_display(bool has_fix)
 }
 
 /*
-Function : gnss_start_searching
+Function : gnss_wakeup
 
 Description : 
-    Waits for GNSS events using k_poll. Handles and displays new PVT and NMEA data.
-    Shows fix or search status updates in the terminal.
+    Wakes up a thread blocked in gnss_process_events(). Used to deliver
+    requests to the GNSS state machine without waiting for the next PVT epoch.
 
 Parameter : 
     void
 
 Return : 
-    int - Always returns 0
+    void
 
 Example Call : 
-    while (1) {
-        gnss_start_searching();
+    gnss_wakeup();
+*/
+void gnss_wakeup(void)
+{
+    k_poll_signal_raise(&wakeup_signal, 0);
+}
+
+/*
+Function : nmea_drain
+
+Description : 
+    Frees all queued NMEA sentences. Called once per loop wakeup, so the
+    sentences of an epoch are handled in the same burst as the next PVT
+    instead of waking the loop one by one.
+
+Parameter : 
+    void
+
+Return : 
+    void
+
+Example Call : 
+    nmea_drain();
+*/
+static void nmea_drain(void)
+{
+    while (k_msgq_get(&nmea_queue, &nmea_data, K_NO_WAIT) == 0)
+    {
+        k_mem_slab_free(&nmea_slab, nmea_data);
     }
+}
+
+/*
+Function : gnss_process_events
+
+Description : 
+    Waits for GNSS events using k_poll. Handles and displays new PVT data and
+    frees the NMEA data queued since the previous wakeup, so all work of an
+    epoch is done in one burst. Shows fix or search status updates in the
+    terminal.
+
+Parameter : 
+    k_timeout_t timeout - Maximum time to wait for an event
+
+Return : 
+    enum gnss_event - GNSS_EVENT_FIX or GNSS_EVENT_PVT when PVT data was handled,
+                      GNSS_EVENT_NONE on timeout or wakeup
+
+Example Call : 
+    enum gnss_event event = gnss_process_events(K_SECONDS(1));
 */
-int gnss_start_searching(void)
+enum gnss_event gnss_process_events(k_timeout_t timeout)
 {
-    (void)k_poll(events, 2, K_FOREVER);
+    enum gnss_event event = GNSS_EVENT_NONE;
+
+    int err = k_poll(events, ARRAY_SIZE(events), timeout);
+
+    nmea_drain();
+
+    if (err == -EAGAIN)
+    {
+        sleep_stats_loop_wakeup(SLEEP_STATS_WAKEUP_TIMEOUT);
+    }
 
     if (events[0].state == K_POLL_STATE_SEM_AVAILABLE &&
         k_sem_take(events[0].sem, K_NO_WAIT) == 0)
     {
-        static bool first_display = true;
+        struct gnss_sv_msg summary;
+        uint8_t confidence = 0;
+
+        sv_summary_get(&last_pvt, &summary);
+        satellite_history_update(&last_pvt);
+        if (last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID)
+        {
+            confidence = fix_confidence_get(&last_pvt, &summary);
+        }
+        altitude_filter_update(&last_pvt);
+        if (last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID)
+        {
+            heading_filter_update(&last_pvt);
+        }
+        publish_pvt(&last_pvt, &summary, confidence);
+        acquisition_update(last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID);
+        bool downloaded = sched_download_update(&last_pvt);
 
-        if (!first_display)
+        if (last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID)
         {
-            refresh_display(last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID);
+            ephemeris_update(&last_pvt, downloaded);
+#if defined(CONFIG_GNSS_SAMPLE_EPHEMERIS_REFRESH)
+            ephemeris_refresh_update();
+#endif
         }
 
-        first_display = false;
+        sleep_stats_loop_wakeup(SLEEP_STATS_WAKEUP_PVT);
+        sleep_stats_epoch();
+        log_stats_epoch();
+
+        refresh_display();
 
-        // Now reprint only the 4 lines
-        print_satellite_stats(&last_pvt);
+        // Now reprint the epoch
+        print_satellite_stats(&summary);
         print_flags(&last_pvt);
-        printf("-----------------------------------\n");
+        if (IS_ENABLED(CONFIG_GNSS_SAMPLE_TERMINAL_REFRESH))
+        {
+            printf("-----------------------------------\n");
+            display_lines++;
+        }
 
         if (last_pvt.flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID)
         {
-            fix_timestamp = k_uptime_get();
-            print_fix_data(&last_pvt);
-            print_distance_from_reference(&last_pvt);
+            last_fix_uptime = k_uptime_get();
+            fix_timestamp = last_fix_uptime;
+            last_sv_used = summary.in_fix;
+            print_fix_data(&last_pvt, confidence);
+
+            struct geo_nav nav;
+
+            if (reference_nav_get(&last_pvt, &nav))
+            {
+                print_distance_from_reference(&nav);
+#if defined(CONFIG_GNSS_SAMPLE_LOW_ACCURACY_AUTO)
+                low_accuracy_update(&nav);
+#endif
+            }
+            event = GNSS_EVENT_FIX;
         }
         else
         {
@@ -518,17 +1682,43 @@ int gnss_start_searching(void)
                     (uint32_t)((k_uptime_get() - fix_timestamp) / 1000));
             cnt++;
             LOG_INF("Searching [%c]", update_indicator[cnt % 4]);
+            event = GNSS_EVENT_PVT;
         }
     }
 
-    if (events[1].state == K_POLL_STATE_MSGQ_DATA_AVAILABLE &&
-        k_msgq_get(events[1].msgq, &nmea_data, K_NO_WAIT) == 0)
+    if (events[1].state == K_POLL_STATE_SIGNALED)
     {
-        k_free(nmea_data);
+        sleep_stats_loop_wakeup(SLEEP_STATS_WAKEUP_REQUEST);
+        k_poll_signal_reset(events[1].signal);
     }
 
     events[0].state = K_POLL_STATE_NOT_READY;
     events[1].state = K_POLL_STATE_NOT_READY;
 
+    return event;
+}
+
+/*
+Function : gnss_start_searching
+
+Description : 
+    Waits for GNSS events without a timeout and handles them. Kept for
+    applications that drive GNSS without the state machine.
+
+Parameter : 
+    void
+
+Return : 
+    int - Always returns 0
+
+Example Call : 
+    while (1) {
+        gnss_start_searching();
+    }
+*/
+int gnss_start_searching(void)
+{
+    (void)gnss_process_events(K_FOREVER);
+
     return 0;
 }
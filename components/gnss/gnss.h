@@ -2,8 +2,8 @@
 Name : gnss.h
 
 Description :  
-    Header file for GNSS-related functions. Declares interfaces for initializing
-    the GNSS subsystem and starting the GNSS tracking/searching loop.
+    Header file for GNSS-related functions. Declares interfaces for initializing,
+    starting and stopping the GNSS subsystem and processing GNSS events.
 
 Developer : Engr Akbar Shah
 
@@ -13,8 +13,39 @@ Date : May 16, 2025
 #ifndef _GNSS_H
 #define _GNSS_H
 
-int gnss_start_searching(void);
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+
+struct ttff_features;
+
+/* Result of processing one batch of GNSS events. */
+enum gnss_event
+{
+    GNSS_EVENT_NONE, /* Timeout or wakeup */
+    GNSS_EVENT_PVT,  /* PVT notification without a valid fix */
+    GNSS_EVENT_FIX,  /* PVT notification with a valid fix */
+};
+
+int gnss_init(void);
+
+int gnss_start(void);
+
+int gnss_stop(void);
 
 int gnss_init_and_start(void);
 
-#endif
\ No newline at end of file
+int gnss_low_accuracy_set(bool enable);
+
+bool gnss_sched_download_active(void);
+
+void gnss_ttff_features_get(struct ttff_features *features, int64_t start);
+
+enum gnss_event gnss_process_events(k_timeout_t timeout);
+
+void gnss_wakeup(void);
+
+void gnss_reference_set(double latitude, double longitude);
+
+int gnss_start_searching(void);
+
+#endif
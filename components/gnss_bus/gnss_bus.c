@@ -0,0 +1,243 @@
+/*
+Name : gnss_bus.c
+
+Description :
+    This source file defines the zbus channels the GNSS component publishes on.
+    Optionally measures publish latency per channel and, with benchmark listeners
+    attached at runtime, the notify latency seen by the last listener, so the cost
+    of each additional subscriber can be measured on target.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+#if defined(CONFIG_GNSS_SAMPLE_BUS_STATS)
+#include <zephyr/timing/timing.h>
+#endif
+#include "gnss_bus.h"
+
+LOG_MODULE_REGISTER(GNSS_BUS);
+
+#define PUBLISH_TIMEOUT K_MSEC(10)
+
+/* Publish latency statistics, stored as channel user data. */
+struct bus_stats
+{
+    uint32_t count;
+    uint64_t total_cycles;
+    uint64_t max_cycles;
+    uint64_t notify_cycles;
+};
+
+static struct bus_stats fix_stats;
+static struct bus_stats sv_stats;
+static struct bus_stats status_stats;
+
+ZBUS_CHAN_DEFINE(gnss_fix_chan,
+                 struct gnss_fix_msg,
+                 NULL,
+                 &fix_stats,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(gnss_sv_chan,
+                 struct gnss_sv_msg,
+                 NULL,
+                 &sv_stats,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+ZBUS_CHAN_DEFINE(gnss_status_chan,
+                 struct gnss_status_msg,
+                 NULL,
+                 &status_stats,
+                 ZBUS_OBSERVERS_EMPTY,
+                 ZBUS_MSG_INIT(0));
+
+#if defined(CONFIG_GNSS_SAMPLE_BUS_STATS)
+/* Timing API (DWT cycle counter), k_cycle_get_32() is the 32 kHz RTC on nRF91. */
+static timing_t publish_start;
+static uint64_t last_notify;
+
+/*
+Function : bench_listener_cb
+
+Description :
+    No-op listener used to load the channels with extra subscribers. Records the
+    cycles from the start of the publish to the time it was notified; as
+    listeners run in order, the last one sees the worst-case notify latency.
+
+Parameter :
+    const struct zbus_channel *chan - Channel that was published
+
+Return :
+    void
+
+Example Call :
+    Called by zbus.
+*/
+static void bench_listener_cb(const struct zbus_channel *chan)
+{
+    ARG_UNUSED(chan);
+
+    timing_t now = timing_counter_get();
+
+    last_notify = timing_cycles_get(&publish_start, &now);
+}
+
+#define BENCH_LISTENER_DEFINE(n) ZBUS_LISTENER_DEFINE(bench_lis_##n, bench_listener_cb)
+
+BENCH_LISTENER_DEFINE(0);
+BENCH_LISTENER_DEFINE(1);
+BENCH_LISTENER_DEFINE(2);
+BENCH_LISTENER_DEFINE(3);
+BENCH_LISTENER_DEFINE(4);
+BENCH_LISTENER_DEFINE(5);
+BENCH_LISTENER_DEFINE(6);
+BENCH_LISTENER_DEFINE(7);
+
+static const struct zbus_observer *const bench_listeners[] = {
+    &bench_lis_0, &bench_lis_1, &bench_lis_2, &bench_lis_3,
+    &bench_lis_4, &bench_lis_5, &bench_lis_6, &bench_lis_7,
+};
+
+BUILD_ASSERT(CONFIG_GNSS_SAMPLE_BUS_BENCH_LISTENERS <= ARRAY_SIZE(bench_listeners));
+
+/* Static observer nodes of the benchmark listeners, zbus does not allocate them. */
+static struct zbus_observer_node bench_nodes[3][ARRAY_SIZE(bench_listeners)];
+
+/*
+Function : stats_update
+
+Description :
+    Accumulates the latency of one publish and logs the averages every
+    CONFIG_GNSS_SAMPLE_BUS_STATS_INTERVAL publishes.
+
+Parameter :
+    const struct zbus_channel *chan - Channel that was published
+    uint64_t cycles                 - Cycles spent in zbus_chan_pub()
+
+Return :
+    void
+
+Example Call :
+    stats_update(chan, timing_cycles_get(&publish_start, &end));
+*/
+static void stats_update(const struct zbus_channel *chan, uint64_t cycles)
+{
+    struct bus_stats *stats = zbus_chan_user_data(chan);
+
+    stats->count++;
+    stats->total_cycles += cycles;
+    stats->max_cycles = MAX(stats->max_cycles, cycles);
+    stats->notify_cycles += last_notify;
+
+    if (stats->count < CONFIG_GNSS_SAMPLE_BUS_STATS_INTERVAL)
+    {
+        return;
+    }
+
+    LOG_INF("%s: %u listeners, publish avg %u ns max %u ns, last notify avg %u ns",
+            zbus_chan_name(chan),
+            CONFIG_GNSS_SAMPLE_BUS_BENCH_LISTENERS,
+            (uint32_t)timing_cycles_to_ns(stats->total_cycles / stats->count),
+            (uint32_t)timing_cycles_to_ns(stats->max_cycles),
+            (uint32_t)timing_cycles_to_ns(stats->notify_cycles / stats->count));
+
+    memset(stats, 0, sizeof(*stats));
+}
+#endif /* CONFIG_GNSS_SAMPLE_BUS_STATS */
+
+/*
+Function : gnss_bus_init
+
+Description :
+    Attaches the configured number of benchmark listeners to every GNSS channel,
+    with static observer nodes so no heap is needed. Does nothing unless
+    CONFIG_GNSS_SAMPLE_BUS_STATS is enabled.
+
+Parameter :
+    void
+
+Return :
+    int - 0 on success, negative error code on failure
+
+Example Call :
+    gnss_bus_init();
+*/
+int gnss_bus_init(void)
+{
+#if defined(CONFIG_GNSS_SAMPLE_BUS_STATS)
+    timing_init();
+    timing_start();
+
+    const struct zbus_channel *const channels[] = {
+        &gnss_fix_chan, &gnss_sv_chan, &gnss_status_chan,
+    };
+
+    BUILD_ASSERT(ARRAY_SIZE(channels) == ARRAY_SIZE(bench_nodes));
+
+    for (size_t c = 0; c < ARRAY_SIZE(channels); c++)
+    {
+        for (int i = 0; i < CONFIG_GNSS_SAMPLE_BUS_BENCH_LISTENERS; i++)
+        {
+            int err = zbus_chan_add_obs_with_node(channels[c], bench_listeners[i],
+                                                  &bench_nodes[c][i], K_MSEC(100));
+
+            if (err)
+            {
+                LOG_ERR("Failed to add benchmark listener, error: %d", err);
+                return err;
+            }
+        }
+    }
+#endif
+    return 0;
+}
+
+/*
+Function : gnss_bus_publish
+
+Description :
+    Publishes a message on one of the GNSS channels, measuring the latency when
+    statistics are enabled. Publishing fails rather than blocks the GNSS loop if
+    the channel stays busy.
+
+Parameter :
+    const struct zbus_channel *chan - Channel to publish on
+    const void *msg                 - Message matching the channel type
+
+Return :
+    int - 0 on success, negative error code on failure
+
+Example Call :
+    gnss_bus_publish(&gnss_status_chan, &status);
+*/
+int gnss_bus_publish(const struct zbus_channel *chan, const void *msg)
+{
+#if defined(CONFIG_GNSS_SAMPLE_BUS_STATS)
+    last_notify = 0;
+    publish_start = timing_counter_get();
+
+    int err = zbus_chan_pub(chan, msg, PUBLISH_TIMEOUT);
+    timing_t end = timing_counter_get();
+
+    if (err == 0)
+    {
+        stats_update(chan, timing_cycles_get(&publish_start, &end));
+    }
+#else
+    int err = zbus_chan_pub(chan, msg, PUBLISH_TIMEOUT);
+#endif
+
+    if (err)
+    {
+        LOG_WRN("Failed to publish on GNSS channel, error: %d", err);
+    }
+    return err;
+}
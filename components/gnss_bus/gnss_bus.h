@@ -0,0 +1,67 @@
+/*
+Name : gnss_bus.h
+
+Description :
+    Header file for the GNSS zbus channels. Declares the compact messages the GNSS
+    component publishes for fixes, satellite summaries and status flags, so other
+    modules can subscribe without callbacks into gnss.c.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _GNSS_BUS_H
+#define _GNSS_BUS_H
+
+#include <stdint.h>
+#include <zephyr/zbus/zbus.h>
+#include <nrf_modem_gnss.h>
+
+/* Published on gnss_fix_chan for every valid fix. */
+struct gnss_fix_msg
+{
+    double latitude;
+    double longitude;
+    float altitude;
+    float accuracy;
+    float speed;
+    /* Estimated heading and its accuracy (degrees), see components/heading, or
+     * the PVT values without CONFIG_GNSS_SAMPLE_HEADING_FILTER. */
+    float heading;
+    float heading_accuracy;
+    /* Filtered altitude (m) and climb rate (m/s, up positive), or the GNSS
+     * altitude and vertical speed without CONFIG_GNSS_SAMPLE_ALTITUDE_FILTER. */
+    float altitude_filtered;
+    float climb_rate;
+    /* UTC, milliseconds since the Unix epoch. */
+    int64_t timestamp_ms;
+    /* 0 (unusable) to 100, see components/fix_quality. */
+    uint8_t confidence;
+};
+
+/* Published on gnss_sv_chan for every PVT notification. CN0 in 0.1 dB-Hz. */
+struct gnss_sv_msg
+{
+    uint8_t tracked;
+    uint8_t in_fix;
+    uint8_t unhealthy;
+    uint16_t cn0_min;
+    uint16_t cn0_max;
+    uint16_t cn0_avg;
+};
+
+/* Published on gnss_status_chan for every PVT notification. */
+struct gnss_status_msg
+{
+    /* NRF_MODEM_GNSS_PVT_FLAG_* bits. */
+    uint8_t flags;
+};
+
+ZBUS_CHAN_DECLARE(gnss_fix_chan, gnss_sv_chan, gnss_status_chan);
+
+int gnss_bus_init(void);
+
+int gnss_bus_publish(const struct zbus_channel *chan, const void *msg);
+
+#endif
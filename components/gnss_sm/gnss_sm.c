@@ -0,0 +1,1082 @@
+/*
+Name : gnss_sm.c
+
+Description :
+    This source file implements the GNSS lifecycle state machine using the Zephyr
+    State Machine Framework (SMF). The state machine owns starting, stopping and
+    recovering GNSS, and drives all timed transitions (acquisition timeout, PVT
+    watchdog, fix loss, sleep and recovery back-off) from a single control loop.
+
+    STOPPED   - GNSS is not running, waiting for a start request
+    ACQUIRING - GNSS is running and searching for a fix
+    TRACKING  - GNSS is running and producing valid fixes
+    SLEEPING  - GNSS is idle, either stopped by the application for a fixed
+                time, sleeping between periodic fixes on the modem, or stopped
+                until the next scheduled acquisition
+    ERROR     - GNSS failed, restarted after a back-off delay
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/smf.h>
+#include <zephyr/sys/atomic.h>
+#include "gnss.h"
+#include "gnss_sm.h"
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+#include "ttff_model.h"
+#include "metrics.h"
+#endif
+#if defined(CONFIG_GNSS_SAMPLE_INTERVAL_TUNER)
+#include "gnss_bus.h"
+#include "interval_tuner.h"
+#endif
+#if defined(CONFIG_GNSS_SAMPLE_MOTION_WAKEUP)
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#endif
+
+LOG_MODULE_REGISTER(GNSS_SM);
+
+#define REQUEST_START BIT(0)
+#define REQUEST_STOP BIT(1)
+#define REQUEST_SLEEP BIT(2)
+#define REQUEST_USE_CASE BIT(3)
+#define REQUEST_MOTION BIT(4)
+
+#define FIX_LOSS_TIMEOUT_MS (CONFIG_GNSS_SAMPLE_FIX_LOSS_TIMEOUT * MSEC_PER_SEC)
+#define RECOVERY_DELAY_MS (CONFIG_GNSS_SAMPLE_RECOVERY_DELAY * MSEC_PER_SEC)
+#define RECOVERY_DELAY_MAX_MS (CONFIG_GNSS_SAMPLE_RECOVERY_DELAY_MAX * MSEC_PER_SEC)
+
+struct gnss_sm_object
+{
+    /* Must be first, SMF casts the object to its context. */
+    struct smf_ctx ctx;
+
+    enum gnss_sm_state state;
+    enum gnss_event event;
+    int64_t now;
+
+    /* Deadlines in uptime milliseconds, 0 when not armed. */
+    int64_t timer;
+    int64_t watchdog;
+
+    /* Uptime of the first epoch without a fix while tracking. */
+    int64_t fix_lost;
+
+    /* Sleep duration requested by the application, 0 for modem driven sleep. */
+    uint32_t sleep_ms;
+    uint32_t retry_ms;
+
+    bool initialized;
+    int error;
+
+    /* Stop, sleep or use case requests held back by a scheduled download. */
+    bool deferring;
+    int64_t defer_until;
+};
+
+static const struct smf_state gnss_states[];
+
+static struct gnss_sm_object sm;
+
+static atomic_t requests;
+static atomic_t sleep_request_ms;
+
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+#define SCHEDULED_INTERVAL_MS (CONFIG_GNSS_SAMPLE_SCHEDULED_INTERVAL * MSEC_PER_SEC)
+#define SCHEDULED_MARGIN (CONFIG_GNSS_SAMPLE_SCHEDULED_MARGIN / 10.0f)
+
+/* Fix deadline served by the current acquisition, and when it started. */
+static struct
+{
+    int64_t deadline;
+    int64_t start;
+    struct ttff_features features;
+    /* Start of the next acquisition once the fix is in, 0 before. */
+    int64_t next_start;
+} schedule;
+
+static struct ttff_model ttff_model;
+
+#if defined(CONFIG_GNSS_SAMPLE_INTERVAL_TUNER)
+static struct interval_tuner interval_tuner;
+#endif
+
+#if defined(CONFIG_GNSS_SAMPLE_MOTION_WAKEUP)
+static const struct device *const motion_sensor = DEVICE_DT_GET(DT_ALIAS(motion_sensor));
+#endif
+#endif
+
+static const char *const state_names[] = {
+    [GNSS_SM_STOPPED] = "STOPPED",
+    [GNSS_SM_ACQUIRING] = "ACQUIRING",
+    [GNSS_SM_TRACKING] = "TRACKING",
+    [GNSS_SM_SLEEPING] = "SLEEPING",
+    [GNSS_SM_ERROR] = "ERROR",
+};
+
+/*
+Function : deadline_after
+
+Description :
+    Returns the uptime at which a timer of the given length started now expires.
+
+Parameter :
+    uint32_t seconds - Timer length in seconds, 0 disables the timer
+
+Return :
+    int64_t - Deadline in uptime milliseconds, 0 if the timer is disabled
+
+Example Call :
+    sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+*/
+static int64_t deadline_after(uint32_t seconds)
+{
+    if (seconds == 0)
+    {
+        return 0;
+    }
+
+    return sm.now + (int64_t)seconds * MSEC_PER_SEC;
+}
+
+/*
+Function : expired
+
+Description :
+    Checks whether an armed deadline has passed.
+
+Parameter :
+    int64_t deadline - Deadline in uptime milliseconds, 0 if not armed
+
+Return :
+    bool - true if the deadline is armed and has passed
+
+Example Call :
+    if (expired(sm.timer)) { ... }
+*/
+static bool expired(int64_t deadline)
+{
+    return deadline != 0 && sm.now >= deadline;
+}
+
+/*
+Function : next_timeout
+
+Description :
+    Computes how long the control loop may block waiting for GNSS events before
+    the earliest armed deadline must be evaluated.
+
+Parameter :
+    void
+
+Return :
+    k_timeout_t - Time until the earliest deadline, K_FOREVER if none is armed
+
+Example Call :
+    gnss_process_events(next_timeout());
+*/
+static k_timeout_t next_timeout(void)
+{
+    int64_t deadline = sm.timer;
+
+    /* Deferred requests are re-evaluated on the next PVT notification. A use
+     * case change waiting for the next periodic fix does not need a run. */
+    if ((atomic_get(&requests) & ~REQUEST_USE_CASE) != 0 && !sm.deferring)
+    {
+        return K_NO_WAIT;
+    }
+
+    if (sm.watchdog != 0 && (deadline == 0 || sm.watchdog < deadline))
+    {
+        deadline = sm.watchdog;
+    }
+
+    if (sm.deferring && (deadline == 0 || sm.defer_until < deadline))
+    {
+        deadline = sm.defer_until;
+    }
+
+    if (deadline == 0)
+    {
+        return K_FOREVER;
+    }
+
+    int64_t remaining = deadline - k_uptime_get();
+
+    return remaining > 0 ? K_MSEC(remaining) : K_NO_WAIT;
+}
+
+/*
+Function : transition
+
+Description :
+    Logs and performs a transition to a new state.
+
+Parameter :
+    enum gnss_sm_state next - State to enter
+
+Return :
+    void
+
+Example Call :
+    transition(GNSS_SM_TRACKING);
+*/
+static void transition(enum gnss_sm_state next)
+{
+    LOG_INF("GNSS state: %s -> %s", state_names[sm.state], state_names[next]);
+
+    sm.state = next;
+    smf_set_state(SMF_CTX(&sm), &gnss_states[next]);
+}
+
+/*
+Function : download_defer
+
+Description :
+    Decides whether stop, sleep and use case requests are held back because
+    GNSS is downloading navigation data. Stopping GNSS would lose the download, so the
+    requests wait until it completes or CONFIG_GNSS_SAMPLE_SCHED_DOWNLOAD_TIMEOUT
+    seconds have passed.
+
+Parameter :
+    void
+
+Return :
+    bool - true if the requests must stay pending
+
+Example Call :
+    if (download_defer()) { return 0; }
+*/
+static bool download_defer(void)
+{
+    if (!gnss_sched_download_active())
+    {
+        sm.deferring = false;
+        sm.defer_until = 0;
+        return false;
+    }
+
+    if (sm.defer_until == 0)
+    {
+        sm.defer_until = deadline_after(CONFIG_GNSS_SAMPLE_SCHED_DOWNLOAD_TIMEOUT);
+        LOG_INF("GNSS stop deferred until the scheduled download completes");
+    }
+
+    sm.deferring = !expired(sm.defer_until);
+
+    return sm.deferring;
+}
+
+/*
+Function : handle_common_requests
+
+Description :
+    Takes the pending requests and handles the ones every running state treats
+    the same way: stop, sleep and use case changes. The remaining request bits
+    are returned so the calling state can handle start requests. Stop, sleep
+    and use case requests are left pending while a scheduled download is in
+    progress.
+
+    The use case can only be changed with GNSS stopped, so a change restarts
+    the acquisition (a hot start) through the ACQUIRING state, which handles
+    a failed restart. On the fix that ends a periodic or scheduled acquisition,
+    and while the modem sleeps between periodic fixes, a restart would start
+    an extra fix, so the change waits for the next acquisition. With GNSS
+    stopped the next start applies it.
+
+Parameter :
+    bool *handled - Set to true if a transition was made
+
+Return :
+    atomic_val_t - Request bits that were pending
+
+Example Call :
+    atomic_val_t req = handle_common_requests(&handled);
+*/
+static atomic_val_t handle_common_requests(bool *handled)
+{
+    *handled = false;
+
+    if ((atomic_get(&requests) & (REQUEST_STOP | REQUEST_SLEEP | REQUEST_USE_CASE)) &&
+        download_defer())
+    {
+        return 0;
+    }
+
+    atomic_val_t req = atomic_clear(&requests);
+
+    if (req & REQUEST_STOP)
+    {
+        transition(GNSS_SM_STOPPED);
+        *handled = true;
+    }
+    else if (req & REQUEST_SLEEP)
+    {
+        sm.sleep_ms = (uint32_t)atomic_get(&sleep_request_ms);
+        transition(GNSS_SM_SLEEPING);
+        *handled = true;
+    }
+    else if (req & REQUEST_USE_CASE)
+    {
+        /* A fix ends a periodic or scheduled acquisition. */
+        bool fix_ends = sm.state == GNSS_SM_ACQUIRING && sm.event == GNSS_EVENT_FIX &&
+                        !IS_ENABLED(CONFIG_GNSS_SAMPLE_MODE_CONTINUOUS);
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+        /* Or has ended, GNSS only waits for a scheduled download to sleep. */
+        fix_ends = fix_ends || (sm.state == GNSS_SM_ACQUIRING && schedule.next_start != 0);
+#endif
+
+        if (sm.state != GNSS_SM_SLEEPING && !fix_ends)
+        {
+            (void)gnss_stop();
+            transition(GNSS_SM_ACQUIRING);
+            *handled = true;
+        }
+        else if (sm.state != GNSS_SM_SLEEPING || sm.sleep_ms == 0)
+        {
+            atomic_or(&requests, REQUEST_USE_CASE);
+        }
+    }
+
+    return req;
+}
+
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+/*
+Function : schedule_interval_get
+
+Description :
+    Returns the interval until the next fix deadline: the configured interval,
+    or with the interval tuner, the interval learned for the location of the
+    fix just published on gnss_fix_chan.
+
+Parameter :
+    uint32_t on_ms - GNSS on-time spent for the fix
+
+Return :
+    uint32_t - Interval in milliseconds
+
+Example Call :
+    uint32_t interval_ms = schedule_interval_get(ttff);
+*/
+static uint32_t schedule_interval_get(uint32_t on_ms)
+{
+#if defined(CONFIG_GNSS_SAMPLE_INTERVAL_TUNER)
+    struct gnss_fix_msg msg;
+
+    if (zbus_chan_read(&gnss_fix_chan, &msg, K_MSEC(10)) == 0)
+    {
+        struct interval_tuner_fix fix = {
+            .latitude = msg.latitude,
+            .longitude = msg.longitude,
+            .speed = msg.speed,
+            .heading = msg.heading,
+            .time_ms = msg.timestamp_ms,
+        };
+        uint32_t interval_s = interval_tuner_next(&interval_tuner, &fix, on_ms);
+
+        LOG_DBG("Next fix interval %u s", interval_s);
+        return interval_s * MSEC_PER_SEC;
+    }
+#else
+    ARG_UNUSED(on_ms);
+#endif
+    return SCHEDULED_INTERVAL_MS;
+}
+
+/*
+Function : schedule_next_fix
+
+Description :
+    Called on the fix of a scheduled acquisition. Teaches the TTFF model the
+    observed TTFF, then computes the next fix deadline, one interval after the
+    current one, and how long GNSS can sleep so that an acquisition started
+    then, taking the predicted TTFF plus CONFIG_GNSS_SAMPLE_SCHEDULED_MARGIN
+    deviations, has a fix by the deadline.
+
+Parameter :
+    void
+
+Return :
+    uint32_t - Sleep time in milliseconds
+
+Example Call :
+    sm.sleep_ms = schedule_next_fix();
+*/
+static uint32_t schedule_next_fix(void)
+{
+    uint32_t ttff = (uint32_t)(sm.now - schedule.start);
+    struct ttff_features features;
+
+    ttff_model_update(&ttff_model, &schedule.features, ttff);
+
+    /* Parsed from the log by tools/ttff_replay. */
+    LOG_INF("TTFF record: %u,%u,%u,%u", schedule.features.since_fix_s,
+            schedule.features.eph_valid, schedule.features.sv_used, ttff);
+
+    uint32_t interval_ms = schedule_interval_get(ttff);
+    int64_t next = sm.now + interval_ms;
+
+    if (schedule.deadline != 0)
+    {
+        if (sm.now > schedule.deadline)
+        {
+            LOG_WRN("Fix %u ms after its deadline", (uint32_t)(sm.now - schedule.deadline));
+            metrics_inc(METRICS_FIX_DEADLINE_MISSED);
+        }
+        else
+        {
+            metrics_add(METRICS_FIX_EARLY_MS, (uint32_t)(schedule.deadline - sm.now));
+        }
+
+        /* Skip deadlines that can no longer be met. */
+        next = schedule.deadline + interval_ms;
+        while (next <= sm.now)
+        {
+            next += interval_ms;
+        }
+    }
+
+    /* The features depend on the start time, refine the estimate once. */
+    gnss_ttff_features_get(&features, next);
+    int64_t start = next - ttff_model_predict(&ttff_model, &features, SCHEDULED_MARGIN);
+
+    gnss_ttff_features_get(&features, start);
+    start = next - ttff_model_predict(&ttff_model, &features, SCHEDULED_MARGIN);
+
+    schedule.deadline = next;
+
+    return start > sm.now ? (uint32_t)(start - sm.now) : 1;
+}
+#endif /* CONFIG_GNSS_SAMPLE_MODE_SCHEDULED */
+
+/*
+STOPPED state
+
+    Entry stops GNSS and disarms all timers. Run waits for a start request.
+*/
+static void stopped_entry(void *o)
+{
+    ARG_UNUSED(o);
+
+    (void)gnss_stop();
+    sm.timer = 0;
+    sm.watchdog = 0;
+}
+
+static void stopped_run(void *o)
+{
+    ARG_UNUSED(o);
+
+    atomic_val_t req = atomic_clear(&requests);
+
+    if (req & REQUEST_START)
+    {
+        transition(GNSS_SM_ACQUIRING);
+    }
+}
+
+/*
+ACQUIRING state
+
+    Entry configures GNSS if needed and starts it, arming the acquisition
+    timeout and PVT watchdog. Run moves to TRACKING on the first valid fix
+    (SLEEPING in periodic and scheduled modes, in scheduled mode after a
+    running scheduled download) and to ERROR if a timer expires.
+*/
+static void acquiring_entry(void *o)
+{
+    ARG_UNUSED(o);
+
+    sm.error = 0;
+    sm.timer = deadline_after(CONFIG_GNSS_SAMPLE_ACQUISITION_TIMEOUT);
+    sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+
+    if (!sm.initialized)
+    {
+        if (gnss_init() != 0)
+        {
+            sm.error = -1;
+        }
+        sm.initialized = (sm.error == 0);
+    }
+
+    if (sm.error == 0 && gnss_start() != 0)
+    {
+        sm.error = -1;
+    }
+
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+    schedule.start = sm.now;
+    schedule.next_start = 0;
+    gnss_ttff_features_get(&schedule.features, sm.now);
+#endif
+
+    if (sm.error != 0)
+    {
+        /* Transitions are not allowed in entry actions, let run handle it. */
+        sm.timer = sm.now;
+    }
+}
+
+static void acquiring_run(void *o)
+{
+    ARG_UNUSED(o);
+
+    bool handled;
+
+    (void)handle_common_requests(&handled);
+    if (handled)
+    {
+        return;
+    }
+
+    if (sm.error != 0)
+    {
+        transition(GNSS_SM_ERROR);
+        return;
+    }
+
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+    if (sm.event == GNSS_EVENT_FIX && schedule.next_start == 0)
+    {
+        schedule.next_start = sm.now + schedule_next_fix();
+        /* The acquisition is done, only the watchdog guards the download. */
+        sm.timer = 0;
+    }
+
+    if (schedule.next_start != 0)
+    {
+        /* Stop GNSS until the next acquisition has to start, but not under a
+         * scheduled download. */
+        if (download_defer())
+        {
+            if (sm.event != GNSS_EVENT_NONE)
+            {
+                sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+            }
+            return;
+        }
+
+        sm.sleep_ms = (uint32_t)MAX(schedule.next_start - sm.now, 1);
+        transition(GNSS_SM_SLEEPING);
+        return;
+    }
+#endif
+
+    if (sm.event == GNSS_EVENT_FIX)
+    {
+        /* In periodic mode the modem sleeps on its own after each fix. */
+        sm.sleep_ms = 0;
+        transition(IS_ENABLED(CONFIG_GNSS_SAMPLE_MODE_PERIODIC) ? GNSS_SM_SLEEPING
+                                                                : GNSS_SM_TRACKING);
+        return;
+    }
+
+    if (sm.event == GNSS_EVENT_PVT)
+    {
+        sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+    }
+
+    if (expired(sm.watchdog))
+    {
+        LOG_WRN("No PVT notifications from GNSS");
+        transition(GNSS_SM_ERROR);
+    }
+    else if (expired(sm.timer))
+    {
+        LOG_WRN("GNSS acquisition timed out");
+        transition(GNSS_SM_ERROR);
+    }
+}
+
+/*
+TRACKING state
+
+    Entry resets the recovery back-off. Run goes back to ACQUIRING when no valid
+    fix has been produced for CONFIG_GNSS_SAMPLE_FIX_LOSS_TIMEOUT seconds.
+*/
+static void tracking_entry(void *o)
+{
+    ARG_UNUSED(o);
+
+    sm.retry_ms = RECOVERY_DELAY_MS;
+    sm.fix_lost = 0;
+    sm.timer = 0;
+    sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+}
+
+static void tracking_run(void *o)
+{
+    ARG_UNUSED(o);
+
+    bool handled;
+
+    (void)handle_common_requests(&handled);
+    if (handled)
+    {
+        return;
+    }
+
+    if (sm.event == GNSS_EVENT_FIX)
+    {
+        sm.fix_lost = 0;
+        sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+    }
+    else if (sm.event == GNSS_EVENT_PVT)
+    {
+        sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+
+        if (sm.fix_lost == 0)
+        {
+            sm.fix_lost = sm.now;
+        }
+
+        if (sm.now - sm.fix_lost >= FIX_LOSS_TIMEOUT_MS)
+        {
+            transition(GNSS_SM_ACQUIRING);
+            return;
+        }
+    }
+
+    if (expired(sm.watchdog))
+    {
+        LOG_WRN("No PVT notifications from GNSS");
+        transition(GNSS_SM_ERROR);
+    }
+}
+
+/*
+SLEEPING state
+
+    Entry stops GNSS for an application requested sleep, or arms a watchdog
+    covering the modem's own sleep between periodic fixes. Run starts a new
+    acquisition when the sleep ends.
+*/
+static void sleeping_entry(void *o)
+{
+    ARG_UNUSED(o);
+
+    sm.timer = 0;
+    sm.watchdog = 0;
+
+    if (sm.sleep_ms > 0)
+    {
+        (void)gnss_stop();
+        sm.timer = sm.now + sm.sleep_ms;
+    }
+#if defined(CONFIG_GNSS_SAMPLE_MODE_PERIODIC)
+    else
+    {
+        sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PERIODIC_INTERVAL +
+                                     CONFIG_GNSS_SAMPLE_PERIODIC_TIMEOUT +
+                                     CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+    }
+#endif
+}
+
+static void sleeping_run(void *o)
+{
+    ARG_UNUSED(o);
+
+    bool handled;
+    atomic_val_t req = handle_common_requests(&handled);
+
+    if (handled)
+    {
+        return;
+    }
+
+    if ((req & REQUEST_START) || expired(sm.timer))
+    {
+        transition(GNSS_SM_ACQUIRING);
+        return;
+    }
+
+#if defined(CONFIG_GNSS_SAMPLE_INTERVAL_TUNER)
+    /* A trip started during a learned interval, get its first fix now and
+     * count the next interval from it. */
+    if ((req & REQUEST_MOTION) && schedule.next_start != 0)
+    {
+        interval_tuner_wake(&interval_tuner);
+        schedule.deadline = 0;
+        transition(GNSS_SM_ACQUIRING);
+        return;
+    }
+#endif
+
+    /* Events are stale leftovers when the application stopped GNSS. */
+    if (sm.sleep_ms == 0)
+    {
+        if (sm.event == GNSS_EVENT_PVT)
+        {
+            /* Restart the waking fix with a use case change waiting for it. */
+            if (!gnss_sched_download_active() &&
+                (atomic_and(&requests, ~REQUEST_USE_CASE) & REQUEST_USE_CASE))
+            {
+                (void)gnss_stop();
+            }
+            transition(GNSS_SM_ACQUIRING);
+            return;
+        }
+
+        if (sm.event == GNSS_EVENT_FIX)
+        {
+            sm.watchdog = deadline_after(CONFIG_GNSS_SAMPLE_PVT_WATCHDOG_TIMEOUT);
+        }
+    }
+
+    if (expired(sm.watchdog))
+    {
+        LOG_WRN("GNSS did not wake up from sleep");
+        transition(GNSS_SM_ERROR);
+    }
+}
+
+static void sleeping_exit(void *o)
+{
+    ARG_UNUSED(o);
+
+    sm.sleep_ms = 0;
+}
+
+/*
+ERROR state
+
+    Entry stops GNSS and schedules a recovery with exponential back-off capped at
+    CONFIG_GNSS_SAMPLE_RECOVERY_DELAY_MAX seconds. Run restarts the acquisition
+    with a full reconfiguration when the back-off expires.
+*/
+static void error_entry(void *o)
+{
+    ARG_UNUSED(o);
+
+    (void)gnss_stop();
+
+    /* Re-run the full configuration on recovery. */
+    sm.initialized = false;
+    sm.watchdog = 0;
+    sm.timer = sm.now + sm.retry_ms;
+
+    LOG_WRN("GNSS recovery in %u s", sm.retry_ms / MSEC_PER_SEC);
+
+    sm.retry_ms = MIN(sm.retry_ms * 2, RECOVERY_DELAY_MAX_MS);
+}
+
+static void error_run(void *o)
+{
+    ARG_UNUSED(o);
+
+    atomic_val_t req = atomic_clear(&requests);
+
+    if (req & REQUEST_STOP)
+    {
+        transition(GNSS_SM_STOPPED);
+    }
+    else if ((req & REQUEST_START) || expired(sm.timer))
+    {
+        transition(GNSS_SM_ACQUIRING);
+    }
+}
+
+static const struct smf_state gnss_states[] = {
+    [GNSS_SM_STOPPED] = SMF_CREATE_STATE(stopped_entry, stopped_run, NULL, NULL, NULL),
+    [GNSS_SM_ACQUIRING] = SMF_CREATE_STATE(acquiring_entry, acquiring_run, NULL, NULL, NULL),
+    [GNSS_SM_TRACKING] = SMF_CREATE_STATE(tracking_entry, tracking_run, NULL, NULL, NULL),
+    [GNSS_SM_SLEEPING] = SMF_CREATE_STATE(sleeping_entry, sleeping_run, sleeping_exit,
+                                          NULL, NULL),
+    [GNSS_SM_ERROR] = SMF_CREATE_STATE(error_entry, error_run, NULL, NULL, NULL),
+};
+
+#if defined(CONFIG_GNSS_SAMPLE_MOTION_WAKEUP)
+/*
+Function : motion_handler
+
+Description :
+    Motion trigger handler of the motion sensor, requests a motion wakeup.
+
+Parameter :
+    const struct device *dev             - Motion sensor
+    const struct sensor_trigger *trigger - Trigger that fired
+
+Return :
+    void
+
+Example Call :
+    sensor_trigger_set(motion_sensor, &trigger, motion_handler);
+*/
+static void motion_handler(const struct device *dev, const struct sensor_trigger *trigger)
+{
+    ARG_UNUSED(dev);
+    ARG_UNUSED(trigger);
+
+    gnss_sm_request_motion();
+}
+
+/*
+Function : motion_wakeup_init
+
+Description :
+    Sets the motion trigger of the sensor behind the motion-sensor devicetree
+    alias. Without it the interval tuner runs without motion wakeups.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    motion_wakeup_init();
+*/
+static void motion_wakeup_init(void)
+{
+    static const struct sensor_trigger trigger = {
+        .type = SENSOR_TRIG_MOTION,
+        .chan = SENSOR_CHAN_ACCEL_XYZ,
+    };
+
+    if (!device_is_ready(motion_sensor))
+    {
+        LOG_WRN("Motion sensor not ready, no motion wakeups");
+        return;
+    }
+
+    if (sensor_trigger_set(motion_sensor, &trigger, motion_handler) != 0)
+    {
+        LOG_WRN("Failed to set the motion trigger, no motion wakeups");
+    }
+}
+#endif
+
+/*
+Function : gnss_sm_init
+
+Description :
+    Initializes the GNSS state machine in the STOPPED state and requests GNSS to
+    be started. GNSS itself is configured when the state machine first enters
+    the ACQUIRING state.
+
+Parameter :
+    void
+
+Return :
+    int - Always returns 0
+
+Example Call :
+    gnss_sm_init();
+*/
+int gnss_sm_init(void)
+{
+    sm.now = k_uptime_get();
+    sm.retry_ms = RECOVERY_DELAY_MS;
+    sm.state = GNSS_SM_STOPPED;
+
+#if defined(CONFIG_GNSS_SAMPLE_MODE_SCHEDULED)
+    ttff_model_init(&ttff_model, CONFIG_GNSS_SAMPLE_EPHEMERIS_MIN_SV);
+#endif
+#if defined(CONFIG_GNSS_SAMPLE_INTERVAL_TUNER)
+    interval_tuner_init(&interval_tuner, CONFIG_GNSS_SAMPLE_INTERVAL_TUNER_MAX_ERROR,
+                        CONFIG_GNSS_SAMPLE_INTERVAL_TUNER_GEOHASH_BITS,
+                        CONFIG_GNSS_SAMPLE_INTERVAL_TUNER_MIN_INTERVAL,
+                        CONFIG_GNSS_SAMPLE_INTERVAL_TUNER_MAX_INTERVAL);
+#endif
+#if defined(CONFIG_GNSS_SAMPLE_MOTION_WAKEUP)
+    motion_wakeup_init();
+#endif
+
+    smf_set_initial(SMF_CTX(&sm), &gnss_states[GNSS_SM_STOPPED]);
+
+    gnss_sm_request_start();
+
+    return 0;
+}
+
+/*
+Function : gnss_sm_run
+
+Description :
+    Runs one iteration of the GNSS control loop: waits for GNSS events or the
+    next state deadline, then runs the current state.
+
+Parameter :
+    void
+
+Return :
+    int - 0 while the state machine is running, non-zero if it terminated
+
+Example Call :
+    while (1) {
+        gnss_sm_run();
+    }
+*/
+int gnss_sm_run(void)
+{
+    sm.event = gnss_process_events(next_timeout());
+    sm.now = k_uptime_get();
+
+    return smf_run_state(SMF_CTX(&sm));
+}
+
+/*
+Function : gnss_sm_state_get
+
+Description :
+    Returns the current state of the GNSS state machine.
+
+Parameter :
+    void
+
+Return :
+    enum gnss_sm_state - Current state
+
+Example Call :
+    if (gnss_sm_state_get() == GNSS_SM_TRACKING) { ... }
+*/
+enum gnss_sm_state gnss_sm_state_get(void)
+{
+    return sm.state;
+}
+
+/*
+Function : gnss_sm_state_name
+
+Description :
+    Returns a printable name of a state.
+
+Parameter :
+    enum gnss_sm_state state - State
+
+Return :
+    const char * - State name
+
+Example Call :
+    LOG_INF("%s", gnss_sm_state_name(gnss_sm_state_get()));
+*/
+const char *gnss_sm_state_name(enum gnss_sm_state state)
+{
+    if (state >= ARRAY_SIZE(state_names))
+    {
+        return "UNKNOWN";
+    }
+
+    return state_names[state];
+}
+
+/*
+Function : gnss_sm_request_start
+
+Description :
+    Requests GNSS to be started. Handled in the STOPPED, SLEEPING and ERROR
+    states, ignored while GNSS is already running.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    gnss_sm_request_start();
+*/
+void gnss_sm_request_start(void)
+{
+    atomic_or(&requests, REQUEST_START);
+    gnss_wakeup();
+}
+
+/*
+Function : gnss_sm_request_stop
+
+Description :
+    Requests GNSS to be stopped until the next start request.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    gnss_sm_request_stop();
+*/
+void gnss_sm_request_stop(void)
+{
+    atomic_or(&requests, REQUEST_STOP);
+    gnss_wakeup();
+}
+
+/*
+Function : gnss_sm_request_use_case
+
+Description :
+    Requests a changed GNSS use case (see gnss_low_accuracy_set()) to be
+    applied. Running GNSS is restarted with it, unless a scheduled download is
+    in progress or the modem sleeps between periodic fixes, in which case the
+    restart waits for the download to end or for the next fix.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    gnss_sm_request_use_case();
+*/
+void gnss_sm_request_use_case(void)
+{
+    atomic_or(&requests, REQUEST_USE_CASE);
+    gnss_wakeup();
+}
+
+/*
+Function : gnss_sm_request_motion
+
+Description :
+    Reports that the device started moving. In scheduled mode with the
+    interval tuner, a sleep until the next learned fix is ended so the trip
+    gets a fix right away. Ignored otherwise.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    gnss_sm_request_motion();
+*/
+void gnss_sm_request_motion(void)
+{
+    atomic_or(&requests, REQUEST_MOTION);
+    gnss_wakeup();
+}
+
+/*
+Function : gnss_sm_request_sleep
+
+Description :
+    Requests GNSS to be stopped for the given time, after which a new
+    acquisition is started.
+
+Parameter :
+    uint32_t duration_ms - Sleep duration in milliseconds
+
+Return :
+    void
+
+Example Call :
+    gnss_sm_request_sleep(60 * MSEC_PER_SEC);
+*/
+void gnss_sm_request_sleep(uint32_t duration_ms)
+{
+    atomic_set(&sleep_request_ms, (atomic_val_t)MAX(duration_ms, 1U));
+    atomic_or(&requests, REQUEST_SLEEP);
+    gnss_wakeup();
+}
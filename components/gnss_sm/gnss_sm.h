@@ -0,0 +1,45 @@
+/*
+Name : gnss_sm.h
+
+Description :
+    Header file for the GNSS lifecycle state machine. Declares the states owned
+    by the state machine and the requests other modules can make to it.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _GNSS_SM_H
+#define _GNSS_SM_H
+
+#include <stdint.h>
+
+enum gnss_sm_state
+{
+    GNSS_SM_STOPPED,
+    GNSS_SM_ACQUIRING,
+    GNSS_SM_TRACKING,
+    GNSS_SM_SLEEPING,
+    GNSS_SM_ERROR,
+};
+
+int gnss_sm_init(void);
+
+int gnss_sm_run(void);
+
+enum gnss_sm_state gnss_sm_state_get(void);
+
+const char *gnss_sm_state_name(enum gnss_sm_state state);
+
+void gnss_sm_request_start(void);
+
+void gnss_sm_request_stop(void);
+
+void gnss_sm_request_sleep(uint32_t duration_ms);
+
+void gnss_sm_request_use_case(void);
+
+void gnss_sm_request_motion(void);
+
+#endif
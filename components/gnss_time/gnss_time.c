@@ -0,0 +1,223 @@
+/*
+Name : gnss_time.c
+
+Description :
+    This source file implements GNSS time conversion without mktime() or any
+    time zone handling: days are counted with a cumulative days-per-month table
+    and a closed-form leap year count, and the GPS-UTC offset is looked up in a
+    leap second table searched from the newest entry.
+
+    A leap second itself (second 60) folds into the first second of the next
+    minute, as in POSIX time. The file has no Zephyr dependencies so it can be
+    used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdint.h>
+#include "gnss_time.h"
+
+#define MS_PER_SECOND 1000LL
+#define MS_PER_DAY 86400000LL
+
+/* Leap years in [1, 1970). */
+#define LEAP_YEARS_BEFORE_1970 477
+
+static const uint16_t days_before_month[12] = {
+    0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334,
+};
+
+/* GPS-UTC offset in seconds from the given Unix time (UTC) onwards. Must be
+ * extended when a new leap second is announced (IERS Bulletin C). */
+static const struct
+{
+    int64_t unix_seconds;
+    int8_t offset;
+} leap_seconds[] = {
+    {362793600LL, 1},   /* 1981-07-01 */
+    {394329600LL, 2},   /* 1982-07-01 */
+    {425865600LL, 3},   /* 1983-07-01 */
+    {489024000LL, 4},   /* 1985-07-01 */
+    {567993600LL, 5},   /* 1988-01-01 */
+    {631152000LL, 6},   /* 1990-01-01 */
+    {662688000LL, 7},   /* 1991-01-01 */
+    {709948800LL, 8},   /* 1992-07-01 */
+    {741484800LL, 9},   /* 1993-07-01 */
+    {773020800LL, 10},  /* 1994-07-01 */
+    {820454400LL, 11},  /* 1996-01-01 */
+    {867715200LL, 12},  /* 1997-07-01 */
+    {915148800LL, 13},  /* 1999-01-01 */
+    {1136073600LL, 14}, /* 2006-01-01 */
+    {1230768000LL, 15}, /* 2009-01-01 */
+    {1341100800LL, 16}, /* 2012-07-01 */
+    {1435708800LL, 17}, /* 2015-07-01 */
+    {1483228800LL, 18}, /* 2017-01-01 */
+};
+
+#define LEAP_SECONDS_COUNT (sizeof(leap_seconds) / sizeof(leap_seconds[0]))
+
+/*
+Function : is_leap_year
+
+Description :
+    Checks whether a year is a Gregorian leap year.
+
+Parameter :
+    uint32_t year - Year
+
+Return :
+    int - 1 for a leap year, 0 otherwise
+
+Example Call :
+    days += is_leap_year(year);
+*/
+static inline int is_leap_year(uint32_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+/*
+Function : gnss_time_utc_ms
+
+Description :
+    Converts a broken-down UTC date and time to milliseconds since the Unix
+    epoch. Fields are expected in the ranges reported by GNSS, year >= 1970.
+
+Parameter :
+    uint16_t year   - Year, e.g. 2026
+    uint8_t month   - Month, 1-12
+    uint8_t day     - Day of month, 1-31
+    uint8_t hour    - Hour, 0-23
+    uint8_t minute  - Minute, 0-59
+    uint8_t seconds - Second, 0-60
+    uint16_t ms     - Millisecond, 0-999
+
+Return :
+    int64_t - Milliseconds since 1970-01-01 00:00:00 UTC
+
+Example Call :
+    int64_t ts = gnss_time_utc_ms(dt->year, dt->month, dt->day,
+                                  dt->hour, dt->minute, dt->seconds, dt->ms);
+*/
+int64_t gnss_time_utc_ms(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                         uint8_t minute, uint8_t seconds, uint16_t ms)
+{
+    uint32_t prev = year - 1U;
+    uint32_t leap_days = prev / 4 - prev / 100 + prev / 400 - LEAP_YEARS_BEFORE_1970;
+    uint32_t m = (month >= 1 && month <= 12) ? month - 1U : 0;
+
+    int64_t days = (int64_t)(year - 1970) * 365 + leap_days + days_before_month[m] + day - 1;
+
+    if (m >= 2)
+    {
+        days += is_leap_year(year);
+    }
+
+    return days * MS_PER_DAY +
+           ((int64_t)hour * 3600 + (int64_t)minute * 60 + seconds) * MS_PER_SECOND + ms;
+}
+
+/*
+Function : gnss_time_leap_seconds
+
+Description :
+    Returns the GPS-UTC offset (leap seconds since the GPS epoch) in effect at
+    a UTC time.
+
+Parameter :
+    int64_t utc_ms - UTC time in Unix milliseconds
+
+Return :
+    int - GPS-UTC offset in seconds
+
+Example Call :
+    int leap = gnss_time_leap_seconds(ts);
+*/
+int gnss_time_leap_seconds(int64_t utc_ms)
+{
+    int64_t seconds = utc_ms / MS_PER_SECOND;
+
+    /* Newest first, current timestamps match on the first comparison. */
+    for (int i = LEAP_SECONDS_COUNT - 1; i >= 0; i--)
+    {
+        if (seconds >= leap_seconds[i].unix_seconds)
+        {
+            return leap_seconds[i].offset;
+        }
+    }
+
+    return 0;
+}
+
+/*
+Function : gnss_time_utc_to_gps_ms
+
+Description :
+    Converts UTC Unix milliseconds to GPS time in milliseconds since the GPS
+    epoch (1980-01-06).
+
+Parameter :
+    int64_t utc_ms - UTC time in Unix milliseconds
+
+Return :
+    int64_t - GPS time in milliseconds
+
+Example Call :
+    int64_t gps_ms = gnss_time_utc_to_gps_ms(ts);
+*/
+int64_t gnss_time_utc_to_gps_ms(int64_t utc_ms)
+{
+    return utc_ms - GNSS_TIME_GPS_EPOCH_UNIX_MS +
+           gnss_time_leap_seconds(utc_ms) * MS_PER_SECOND;
+}
+
+/*
+Function : gnss_time_gps_to_utc_ms
+
+Description :
+    Converts GPS time in milliseconds since the GPS epoch to UTC Unix
+    milliseconds.
+
+Parameter :
+    int64_t gps_ms - GPS time in milliseconds
+
+Return :
+    int64_t - UTC time in Unix milliseconds
+
+Example Call :
+    int64_t ts = gnss_time_gps_to_utc_ms(gps_ms);
+*/
+int64_t gnss_time_gps_to_utc_ms(int64_t gps_ms)
+{
+    int64_t approx = gps_ms + GNSS_TIME_GPS_EPOCH_UNIX_MS;
+    int64_t utc_ms = approx - gnss_time_leap_seconds(approx) * MS_PER_SECOND;
+
+    /* The offset may change between the approximation and the result. */
+    return approx - gnss_time_leap_seconds(utc_ms) * MS_PER_SECOND;
+}
+
+/*
+Function : gnss_time_gps_week
+
+Description :
+    Splits GPS time into the full (not modulo 1024) GPS week number and the
+    time of week.
+
+Parameter :
+    int64_t gps_ms   - GPS time in milliseconds
+    uint16_t *week   - GPS week number
+    uint32_t *tow_ms - Time of week in milliseconds
+
+Return :
+    void
+
+Example Call :
+    gnss_time_gps_week(gps_ms, &week, &tow_ms);
+*/
+void gnss_time_gps_week(int64_t gps_ms, uint16_t *week, uint32_t *tow_ms)
+{
+    *week = (uint16_t)(gps_ms / GNSS_TIME_WEEK_MS);
+    *tow_ms = (uint32_t)(gps_ms % GNSS_TIME_WEEK_MS);
+}
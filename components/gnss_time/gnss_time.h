@@ -0,0 +1,35 @@
+/*
+Name : gnss_time.h
+
+Description :
+    Header file for GNSS time conversion. Declares conversion of broken-down UTC
+    date and time (as in the PVT datetime) to 64-bit Unix epoch milliseconds, and
+    between UTC and GPS time (leap seconds, GPS week and time of week).
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _GNSS_TIME_H
+#define _GNSS_TIME_H
+
+#include <stdint.h>
+
+/* 1980-01-06 00:00:00 UTC in Unix milliseconds. */
+#define GNSS_TIME_GPS_EPOCH_UNIX_MS 315964800000LL
+
+#define GNSS_TIME_WEEK_MS 604800000LL
+
+int64_t gnss_time_utc_ms(uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                         uint8_t minute, uint8_t seconds, uint16_t ms);
+
+int gnss_time_leap_seconds(int64_t utc_ms);
+
+int64_t gnss_time_utc_to_gps_ms(int64_t utc_ms);
+
+int64_t gnss_time_gps_to_utc_ms(int64_t gps_ms);
+
+void gnss_time_gps_week(int64_t gps_ms, uint16_t *week, uint32_t *tow_ms);
+
+#endif
@@ -0,0 +1,348 @@
+/*
+Name : heading.c
+
+Description :
+    This source file implements the heading estimator, a scalar Kalman filter
+    on the circle: the heading follows a random walk (turns) between fixes.
+
+    At or above the configured speed the PVT heading is used, weighted by the
+    heading accuracy reported with it. Below it the PVT heading, derived from
+    a velocity close to its noise, is effectively random, so the heading is
+    measured from the displacement between the newest position and an older
+    one instead. The window is adaptive: the newest position is compared with
+    progressively older ones until the displacement is MIN_DISPLACEMENT_SIGMAS
+    times its uncertainty (from the position accuracies), so slower movement
+    uses a longer window. Its accuracy is the angle that uncertainty subtends.
+    The PVT heading then only refines the displacement heading, trusted less
+    the slower the device moves. Without a displacement heading (stationary)
+    the heading is held while its accuracy degrades. Every update has a fixed
+    cost of at most HEADING_HISTORY distance checks.
+
+    The file has no Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "heading.h"
+
+#define RAD_TO_DEG 57.2957795f
+#define METERS_PER_DEG_LAT 111195.0f
+
+/* Heading random walk in degrees per sqrt(s). */
+#define TURN_NOISE 10.0f
+
+/* Minimum displacement for a heading, in standard deviations of its error. */
+#define MIN_DISPLACEMENT_SIGMAS 2.0f
+
+/* Oldest position used for the displacement heading. */
+#define MAX_WINDOW_MS (120 * 1000)
+
+/* PVT headings less accurate than this (degrees) are not used. */
+#define MAX_PVT_ACCURACY 90.0f
+#define MIN_PVT_ACCURACY 1.0f
+
+/* Variance of an unknown heading. */
+#define MAX_VARIANCE (180.0f * 180.0f)
+
+/* The position history restarts when it gets this far from its origin. */
+#define MAX_ORIGIN_DISTANCE_M 10000.0f
+
+/*
+Function : heading_init
+
+Description :
+    Initializes an estimator, which starts at the first heading measurement.
+
+Parameter :
+    struct heading_estimator *est - Estimator
+    float fast_speed              - Speed in m/s from which the PVT heading is used
+
+Return :
+    void
+
+Example Call :
+    heading_init(&est, 2.0f);
+*/
+void heading_init(struct heading_estimator *est, float fast_speed)
+{
+    memset(est, 0, sizeof(*est));
+    est->fast_speed = fast_speed;
+    est->variance = MAX_VARIANCE;
+}
+
+/*
+Function : wrap180
+
+Description :
+    Wraps an angle difference to [-180, 180) degrees.
+
+Parameter :
+    float angle - Angle in degrees
+
+Return :
+    float - Wrapped angle in degrees
+
+Example Call :
+    float innovation = wrap180(z - est->heading);
+*/
+static float wrap180(float angle)
+{
+    angle = fmodf(angle + 180.0f, 360.0f);
+    if (angle < 0.0f)
+    {
+        angle += 360.0f;
+    }
+    return angle - 180.0f;
+}
+
+/*
+Function : history_add
+
+Description :
+    Adds a position to the history, in meters east and north of the history
+    origin. The history restarts far from its origin so the flat earth
+    approximation holds.
+
+Parameter :
+    struct heading_estimator *est - Estimator
+    int64_t time_ms               - Time of the fix in milliseconds
+    double latitude               - Latitude in degrees
+    double longitude              - Longitude in degrees
+    float accuracy                - Horizontal accuracy in meters
+
+Return :
+    void
+
+Example Call :
+    history_add(est, time_ms, latitude, longitude, accuracy);
+*/
+static void history_add(struct heading_estimator *est, int64_t time_ms, double latitude,
+                        double longitude, float accuracy)
+{
+    float east = (float)(longitude - est->origin_lon) * est->meters_per_deg_lon;
+    float north = (float)(latitude - est->origin_lat) * METERS_PER_DEG_LAT;
+
+    if (est->count == 0 || fabsf(east) > MAX_ORIGIN_DISTANCE_M ||
+        fabsf(north) > MAX_ORIGIN_DISTANCE_M)
+    {
+        est->origin_lat = latitude;
+        est->origin_lon = longitude;
+        est->meters_per_deg_lon = METERS_PER_DEG_LAT * cosf((float)latitude / RAD_TO_DEG);
+        est->count = 0;
+        east = 0.0f;
+        north = 0.0f;
+    }
+
+    est->newest = (est->newest + 1) % HEADING_HISTORY;
+    est->history[est->newest] = (struct heading_sample){
+        .time_ms = time_ms,
+        .east = east,
+        .north = north,
+        .accuracy = accuracy,
+    };
+
+    if (est->count < HEADING_HISTORY)
+    {
+        est->count++;
+    }
+}
+
+/*
+Function : displacement_heading
+
+Description :
+    Measures the heading from the newest position to the most recent older one
+    that is far enough away for the direction to be meaningful.
+
+Parameter :
+    const struct heading_estimator *est - Estimator
+    float *heading                      - Heading output in degrees
+    float *variance                     - Heading variance output in deg^2
+
+Return :
+    bool - true if a heading was measured, false if the positions are too close
+
+Example Call :
+    if (displacement_heading(est, &z, &r)) { ... }
+*/
+static bool displacement_heading(const struct heading_estimator *est, float *heading,
+                                 float *variance)
+{
+    const struct heading_sample *newest = &est->history[est->newest];
+
+    for (uint8_t i = 1; i < est->count; i++)
+    {
+        const struct heading_sample *s =
+            &est->history[(est->newest + HEADING_HISTORY - i) % HEADING_HISTORY];
+
+        if (newest->time_ms - s->time_ms > MAX_WINDOW_MS)
+        {
+            break;
+        }
+
+        float de = newest->east - s->east;
+        float dn = newest->north - s->north;
+        float distance = sqrtf(de * de + dn * dn);
+        float sigma = sqrtf(newest->accuracy * newest->accuracy + s->accuracy * s->accuracy);
+
+        if (distance >= MIN_DISPLACEMENT_SIGMAS * sigma)
+        {
+            float angle = atan2f(sigma, distance) * RAD_TO_DEG;
+
+            *heading = atan2f(de, dn) * RAD_TO_DEG;
+            *variance = angle * angle;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+Function : measure
+
+Description :
+    Applies a heading measurement; the first one starts the estimator.
+
+Parameter :
+    struct heading_estimator *est - Estimator
+    float z                       - Measured heading in degrees
+    float r                       - Measurement variance in deg^2
+
+Return :
+    void
+
+Example Call :
+    measure(est, heading, sigma * sigma);
+*/
+static void measure(struct heading_estimator *est, float z, float r)
+{
+    if (!est->initialized)
+    {
+        est->heading = z;
+        est->variance = r;
+        est->initialized = true;
+    }
+    else
+    {
+        float k = est->variance / (est->variance + r);
+
+        est->heading += k * wrap180(z - est->heading);
+        est->variance *= 1.0f - k;
+    }
+
+    est->heading = wrap180(est->heading - 180.0f) + 180.0f;
+}
+
+/*
+Function : heading_update
+
+Description :
+    Updates the estimator with a fix: the PVT heading when at or above the
+    fast speed, the displacement heading otherwise. Below the fast speed the
+    PVT heading only refines a displacement heading, with its accuracy scaled
+    by fast speed / speed, so it is trusted less the slower the device moves
+    and never while the device is stationary.
+
+Parameter :
+    struct heading_estimator *est - Estimator
+    int64_t time_ms               - Time of the fix in milliseconds
+    double latitude               - Latitude in degrees
+    double longitude              - Longitude in degrees
+    float accuracy                - Horizontal accuracy in meters
+    float speed                   - Horizontal speed in m/s
+    float heading                 - PVT heading in degrees
+    float heading_accuracy        - PVT heading accuracy in degrees, 0 if unknown
+
+Return :
+    void
+
+Example Call :
+    heading_update(&est, now, pvt->latitude, pvt->longitude, pvt->accuracy,
+                   pvt->speed, pvt->heading, pvt->heading_accuracy);
+*/
+void heading_update(struct heading_estimator *est, int64_t time_ms, double latitude,
+                    double longitude, float accuracy, float speed, float heading,
+                    float heading_accuracy)
+{
+    bool pvt_usable = heading_accuracy > 0.0f && heading_accuracy < MAX_PVT_ACCURACY;
+    float pvt_sigma = fmaxf(heading_accuracy, MIN_PVT_ACCURACY);
+    float z;
+    float r;
+
+    /* Heading random walk since the previous fix. */
+    if (est->initialized && time_ms > est->time_ms)
+    {
+        float dt = (float)(time_ms - est->time_ms) / 1000.0f;
+
+        est->variance = fminf(est->variance + TURN_NOISE * TURN_NOISE * dt, MAX_VARIANCE);
+    }
+    est->time_ms = time_ms;
+
+    if (accuracy > 0.0f)
+    {
+        history_add(est, time_ms, latitude, longitude, accuracy);
+    }
+
+    if (speed >= est->fast_speed && pvt_usable)
+    {
+        measure(est, heading, pvt_sigma * pvt_sigma);
+    }
+    else if (accuracy > 0.0f && displacement_heading(est, &z, &r))
+    {
+        measure(est, z, r);
+
+        if (pvt_usable && speed > 0.0f)
+        {
+            pvt_sigma *= est->fast_speed / speed;
+            measure(est, heading, pvt_sigma * pvt_sigma);
+        }
+    }
+}
+
+/*
+Function : heading_get
+
+Description :
+    Returns the estimated heading.
+
+Parameter :
+    const struct heading_estimator *est - Estimator
+
+Return :
+    float - Heading in degrees, [0, 360), NAN before the first measurement
+
+Example Call :
+    float heading = heading_get(&est);
+*/
+float heading_get(const struct heading_estimator *est)
+{
+    return est->initialized ? est->heading : NAN;
+}
+
+/*
+Function : heading_accuracy_get
+
+Description :
+    Returns the accuracy of the estimated heading. It grows while no heading
+    can be measured, e.g. while stationary.
+
+Parameter :
+    const struct heading_estimator *est - Estimator
+
+Return :
+    float - Heading accuracy (1 sigma) in degrees, 180 if unknown
+
+Example Call :
+    float accuracy = heading_accuracy_get(&est);
+*/
+float heading_accuracy_get(const struct heading_estimator *est)
+{
+    return sqrtf(est->variance);
+}
@@ -0,0 +1,64 @@
+/*
+Name : heading.h
+
+Description :
+    Header file for the heading estimator. Declares a filter that tracks the
+    direction of travel from the PVT heading, weighted by its accuracy, when
+    moving fast and from the displacement over an adaptive window of recent
+    positions when slow, and holds it while stationary.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _HEADING_H
+#define _HEADING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Positions kept for the displacement heading. */
+#define HEADING_HISTORY 32
+
+struct heading_sample
+{
+    int64_t time_ms;
+    float east;     /* m */
+    float north;    /* m */
+    float accuracy; /* m */
+};
+
+struct heading_estimator
+{
+    bool initialized;
+    int64_t time_ms;
+
+    /* Heading (degrees, [0, 360)) and its variance (deg^2). */
+    float heading;
+    float variance;
+
+    /* Speed (m/s) from which the PVT heading is used. */
+    float fast_speed;
+
+    /* Local east/north plane of the position history. */
+    double origin_lat;
+    double origin_lon;
+    float meters_per_deg_lon;
+
+    struct heading_sample history[HEADING_HISTORY];
+    uint8_t newest;
+    uint8_t count;
+};
+
+void heading_init(struct heading_estimator *est, float fast_speed);
+
+void heading_update(struct heading_estimator *est, int64_t time_ms, double latitude,
+                    double longitude, float accuracy, float speed, float heading,
+                    float heading_accuracy);
+
+float heading_get(const struct heading_estimator *est);
+
+float heading_accuracy_get(const struct heading_estimator *est);
+
+#endif
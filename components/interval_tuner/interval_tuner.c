@@ -0,0 +1,334 @@
+/*
+Name : interval_tuner.c
+
+Description :
+    This source file implements the fix interval tuner. After every fix the
+    interval chosen at the previous fix is rewarded and the interval until the
+    next fix is chosen with UCB1 among the candidates of the geohash cell the
+    device is in, so places where the device stays still learn long intervals
+    and places it moves through learn short ones.
+
+    The reward favours low GNSS on-time per second of track (the square root
+    of one second per longest interval over the on-time of a fix divided by
+    the interval before it), but an interval whose track error exceeds the
+    acceptable error gets no reward at all, so the bound is not traded for
+    on-time. The track error is the distance between a fix and the position
+    dead reckoned from the previous fix, an on-line estimate of how far the
+    track between fixes may be off.
+    Intervals are tried shortest first, and none longer than an interval
+    that exceeds the bound too often is tried or chosen in the cell.
+
+    A motion sensor can end an interval early (interval_tuner_wake()), the
+    interval is then not rewarded: the trip started during it was caught.
+    A fix that finds a stationary device moving (by its speed or by how far it
+    is from the previous fix) is the start of a trip, about which the cell
+    knows nothing yet: the shortest interval is used until the moving cells
+    have learned better.
+
+    Cells are kept in a small table, the least recently used cell is replaced
+    when a new one is needed. The file has no Zephyr dependencies so it can be
+    used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "geodesy.h"
+#include "interval_tuner.h"
+
+/* Exploration weight of UCB1, rewards are in [0, 1]. */
+#define EXPLORATION 0.2f
+
+/* Share of an interval's fixes allowed above the acceptable error. */
+#define MAX_OVER_SHARE 0.1f
+
+/* Below this speed the previous fix is taken as the predicted position. */
+#define STATIONARY_SPEED 0.5f
+
+/*
+Function : interval_tuner_init
+
+Description :
+    Initializes a tuner with nothing learned. The candidate intervals are
+    spaced geometrically from the shortest to the longest interval.
+
+Parameter :
+    struct interval_tuner *tuner - Tuner
+    float max_error_m            - Acceptable track error in meters
+    uint8_t geohash_bits         - Geohash bits of a cell, e.g. 25
+    uint16_t min_interval_s      - Shortest interval in seconds
+    uint16_t max_interval_s      - Longest interval in seconds
+
+Return :
+    void
+
+Example Call :
+    interval_tuner_init(&tuner, 100.0f, 25, 30, 600);
+*/
+void interval_tuner_init(struct interval_tuner *tuner, float max_error_m, uint8_t geohash_bits,
+                         uint16_t min_interval_s, uint16_t max_interval_s)
+{
+    float ratio = (float)max_interval_s / (float)min_interval_s;
+
+    memset(tuner, 0, sizeof(*tuner));
+    tuner->max_error_m = max_error_m;
+    tuner->geohash_bits = geohash_bits;
+
+    for (int a = 0; a < INTERVAL_TUNER_ARMS; a++)
+    {
+        float step = (float)a / (INTERVAL_TUNER_ARMS - 1);
+
+        tuner->intervals_s[a] = (uint16_t)lroundf(min_interval_s * powf(ratio, step));
+    }
+}
+
+/*
+Function : interval_tuner_track_error
+
+Description :
+    Estimates the track error between two fixes as the distance between the
+    second fix and the position dead reckoned from the first.
+
+Parameter :
+    const struct interval_tuner_fix *from - Previous fix
+    const struct interval_tuner_fix *to   - Current fix
+
+Return :
+    float - Track error in meters
+
+Example Call :
+    float error = interval_tuner_track_error(&last, &fix);
+*/
+float interval_tuner_track_error(const struct interval_tuner_fix *from,
+                                 const struct interval_tuner_fix *to)
+{
+    double latitude = from->latitude;
+    double longitude = from->longitude;
+
+    if (from->speed >= STATIONARY_SPEED)
+    {
+        struct geo_origin origin;
+        float dt = (float)(to->time_ms - from->time_ms) / 1000.0f;
+
+        geo_origin_set(&origin, from->latitude, from->longitude);
+        geo_destination(&origin, from->heading, from->speed * dt, &latitude, &longitude);
+    }
+
+    return (float)geo_distance(latitude, longitude, to->latitude, to->longitude);
+}
+
+/*
+Function : cell_get
+
+Description :
+    Finds the cell of a geohash and motion state, replacing the least recently
+    used cell if it is not in the table.
+
+Parameter :
+    struct interval_tuner *tuner - Tuner
+    uint32_t geohash             - Geohash of the cell
+    bool moving                  - Device moving at the fix
+
+Return :
+    struct interval_tuner_cell * - Cell
+
+Example Call :
+    struct interval_tuner_cell *cell = cell_get(tuner, geohash, false);
+*/
+static struct interval_tuner_cell *cell_get(struct interval_tuner *tuner, uint32_t geohash,
+                                            bool moving)
+{
+    struct interval_tuner_cell *lru = &tuner->cell[0];
+
+    for (int i = 0; i < INTERVAL_TUNER_CELLS; i++)
+    {
+        struct interval_tuner_cell *cell = &tuner->cell[i];
+
+        /* Unused cells have last_used 0 and are replaced first. */
+        if (cell->last_used != 0 && cell->geohash == geohash && cell->moving == moving)
+        {
+            return cell;
+        }
+
+        if (cell->last_used < lru->last_used)
+        {
+            lru = cell;
+        }
+    }
+
+    memset(lru, 0, sizeof(*lru));
+    lru->geohash = geohash;
+    lru->moving = moving;
+    return lru;
+}
+
+/*
+Function : reward_get
+
+Description :
+    Rewards a fix interval from the on-time of the fix, relative to one second
+    of on-time per longest interval. An interval with a track error above the
+    acceptable error gets no reward.
+
+Parameter :
+    const struct interval_tuner *tuner - Tuner
+    uint32_t interval_s                - Interval before the fix
+    uint32_t on_ms                     - GNSS on-time of the fix
+    float error_m                      - Track error
+
+Return :
+    float - Reward, [0, 1]
+
+Example Call :
+    float reward = reward_get(tuner, 300, 1500, 20.0f);
+*/
+static float reward_get(const struct interval_tuner *tuner, uint32_t interval_s,
+                        uint32_t on_ms, float error_m)
+{
+    /* On-time rate (ms per s) with one second of on-time per longest interval. */
+    float reference = 1000.0f / (float)tuner->intervals_s[INTERVAL_TUNER_ARMS - 1];
+    float on_rate = (float)on_ms / (float)interval_s;
+
+    if (error_m > tuner->max_error_m)
+    {
+        return 0.0f;
+    }
+
+    return on_rate > reference ? sqrtf(reference / on_rate) : 1.0f;
+}
+
+/*
+Function : arm_select
+
+Description :
+    Chooses the interval of a cell with UCB1: untried intervals first, shortest
+    first so a cell the device moves through is not left before it has been
+    learned, then the highest mean reward plus exploration bonus. Intervals
+    longer than one that exceeds the acceptable error too often are neither
+    tried nor chosen.
+
+Parameter :
+    const struct interval_tuner_cell *cell - Cell
+
+Return :
+    uint8_t - Index of the interval
+
+Example Call :
+    uint8_t arm = arm_select(cell);
+*/
+static uint8_t arm_select(const struct interval_tuner_cell *cell)
+{
+    uint8_t best = 0;
+    float best_score = -1.0f;
+    float log_count = logf((float)cell->count + 1.0f);
+
+    for (int a = 0; a < INTERVAL_TUNER_ARMS; a++)
+    {
+        if (cell->arm[a].count == 0)
+        {
+            return (uint8_t)a;
+        }
+
+        if (cell->arm[a].over > MAX_OVER_SHARE * cell->arm[a].count)
+        {
+            break;
+        }
+
+        float score = cell->arm[a].reward +
+                      EXPLORATION * sqrtf(log_count / (float)cell->arm[a].count);
+
+        if (score > best_score)
+        {
+            best_score = score;
+            best = (uint8_t)a;
+        }
+    }
+
+    return best;
+}
+
+/*
+Function : interval_tuner_wake
+
+Description :
+    Records that the pending interval was cut short because the device
+    started moving, so the next fix does not reward it with the track error
+    of the trip.
+
+Parameter :
+    struct interval_tuner *tuner - Tuner
+
+Return :
+    void
+
+Example Call :
+    interval_tuner_wake(&tuner);
+*/
+void interval_tuner_wake(struct interval_tuner *tuner)
+{
+    tuner->woken = true;
+}
+
+/*
+Function : interval_tuner_next
+
+Description :
+    Learns from a fix and chooses the interval until the next one. The
+    interval chosen at the previous fix is rewarded in the cell it was chosen
+    for, then the interval is chosen for the cell of this fix, or is the
+    shortest one if the fix starts a trip.
+
+Parameter :
+    struct interval_tuner *tuner          - Tuner
+    const struct interval_tuner_fix *fix  - Fix
+    uint32_t on_ms                        - GNSS on-time spent for the fix
+
+Return :
+    uint32_t - Interval until the next fix in seconds
+
+Example Call :
+    uint32_t interval_s = interval_tuner_next(&tuner, &fix, ttff_ms);
+*/
+uint32_t interval_tuner_next(struct interval_tuner *tuner, const struct interval_tuner_fix *fix,
+                             uint32_t on_ms)
+{
+    tuner->clock++;
+
+    if (tuner->pending && !tuner->woken)
+    {
+        struct interval_tuner_cell *cell = cell_get(tuner, tuner->pending_geohash,
+                                                    tuner->last_fix.speed >= STATIONARY_SPEED);
+        struct interval_tuner_arm *arm = &cell->arm[tuner->pending_arm];
+        float error = interval_tuner_track_error(&tuner->last_fix, fix);
+        float reward = reward_get(tuner, tuner->intervals_s[tuner->pending_arm], on_ms, error);
+
+        arm->count++;
+        arm->over += error > tuner->max_error_m;
+        arm->reward += (reward - arm->reward) / arm->count;
+        cell->count++;
+        cell->last_used = tuner->clock;
+    }
+
+    /* A stationary device found moving has started a trip. */
+    bool trip_start = tuner->pending && tuner->last_fix.speed < STATIONARY_SPEED &&
+                      (fix->speed >= STATIONARY_SPEED ||
+                       interval_tuner_track_error(&tuner->last_fix, fix) > tuner->max_error_m);
+    uint32_t geohash = geo_geohash(fix->latitude, fix->longitude, tuner->geohash_bits);
+    struct interval_tuner_cell *cell = cell_get(tuner, geohash, fix->speed >= STATIONARY_SPEED);
+    uint8_t arm = trip_start ? 0 : arm_select(cell);
+
+    cell->last_used = tuner->clock;
+
+    tuner->pending = true;
+    tuner->woken = false;
+    tuner->last_fix = *fix;
+    tuner->pending_geohash = geohash;
+    tuner->pending_arm = arm;
+
+    return tuner->intervals_s[arm];
+}
@@ -0,0 +1,78 @@
+/*
+Name : interval_tuner.h
+
+Description :
+    Header file for the learning fix interval tuner. Declares a UCB1 bandit
+    over candidate fix intervals, learned separately for each geohash cell the
+    device visits and its motion state, trading GNSS on-time against track error.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _INTERVAL_TUNER_H
+#define _INTERVAL_TUNER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INTERVAL_TUNER_ARMS 5
+#define INTERVAL_TUNER_CELLS 16
+
+/* Fix as seen by the tuner. */
+struct interval_tuner_fix
+{
+    double latitude;
+    double longitude;
+    float speed;   /* m/s */
+    float heading; /* degrees */
+    int64_t time_ms;
+};
+
+struct interval_tuner_arm
+{
+    uint16_t count;
+    uint16_t over; /* Intervals with a track error above the acceptable error */
+    float reward;  /* Mean reward, [0, 1] */
+};
+
+/* Learned parameters of one geohash cell, moving or stationary. */
+struct interval_tuner_cell
+{
+    uint32_t geohash;
+    bool moving;
+    uint32_t last_used;
+    uint32_t count;
+    struct interval_tuner_arm arm[INTERVAL_TUNER_ARMS];
+};
+
+struct interval_tuner
+{
+    float max_error_m;
+    uint8_t geohash_bits;
+    /* Candidate intervals, shortest first, spaced geometrically. */
+    uint16_t intervals_s[INTERVAL_TUNER_ARMS];
+    uint32_t clock;
+    struct interval_tuner_cell cell[INTERVAL_TUNER_CELLS];
+
+    /* Previous fix and the interval chosen after it. */
+    bool pending;
+    bool woken; /* Interval cut short by motion */
+    struct interval_tuner_fix last_fix;
+    uint32_t pending_geohash;
+    uint8_t pending_arm;
+};
+
+void interval_tuner_init(struct interval_tuner *tuner, float max_error_m, uint8_t geohash_bits,
+                         uint16_t min_interval_s, uint16_t max_interval_s);
+
+void interval_tuner_wake(struct interval_tuner *tuner);
+
+uint32_t interval_tuner_next(struct interval_tuner *tuner, const struct interval_tuner_fix *fix,
+                             uint32_t on_ms);
+
+float interval_tuner_track_error(const struct interval_tuner_fix *from,
+                                 const struct interval_tuner_fix *to);
+
+#endif
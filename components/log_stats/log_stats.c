@@ -0,0 +1,155 @@
+/*
+Name : log_stats.c
+
+Description :
+    This source file implements a counting log backend. It formats every log
+    message exactly like the UART backend (text or dictionary), but only counts
+    the resulting bytes, so the log bandwidth per PVT epoch can be compared
+    between text and dictionary logging on the same firmware.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_output.h>
+#if defined(CONFIG_LOG_BACKEND_UART_OUTPUT_DICTIONARY)
+#include <zephyr/logging/log_output_dict.h>
+#endif
+#include <zephyr/sys/atomic.h>
+#include "log_stats.h"
+
+LOG_MODULE_REGISTER(LOG_STATS);
+
+static uint8_t output_buf[32];
+static atomic_t epoch_bytes;
+static atomic_t output_bytes;
+
+static uint32_t epochs;
+static uint32_t total_bytes;
+static uint32_t max_bytes;
+static bool first_epoch = true;
+
+/*
+Function : count_out
+
+Description :
+    Log output function that discards the formatted data and counts its length.
+
+Parameter :
+    uint8_t *data - Formatted log data
+    size_t length - Number of bytes
+    void *ctx     - Unused
+
+Return :
+    int - Number of bytes consumed
+
+Example Call :
+    Called by the log output module.
+*/
+static int count_out(uint8_t *data, size_t length, void *ctx)
+{
+    ARG_UNUSED(data);
+    ARG_UNUSED(ctx);
+
+    atomic_add(&epoch_bytes, (atomic_val_t)length);
+    atomic_add(&output_bytes, (atomic_val_t)length);
+    return (int)length;
+}
+
+LOG_OUTPUT_DEFINE(log_output_stats, count_out, output_buf, sizeof(output_buf));
+
+static void process(const struct log_backend *const backend, union log_msg_generic *msg)
+{
+    ARG_UNUSED(backend);
+
+    uint32_t flags = log_backend_std_get_flags();
+
+#if defined(CONFIG_LOG_BACKEND_UART_OUTPUT_DICTIONARY)
+    log_dict_output_msg_process(&log_output_stats, &msg->log, flags);
+#else
+    log_output_msg_process(&log_output_stats, &msg->log, flags);
+#endif
+}
+
+static void panic(const struct log_backend *const backend)
+{
+    ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api log_backend_stats_api = {
+    .process = process,
+    .panic = panic,
+};
+
+LOG_BACKEND_DEFINE(log_backend_stats, log_backend_stats_api, true);
+
+/*
+Function : log_stats_epoch
+
+Description :
+    Marks a PVT epoch boundary. Accumulates the log bytes produced since the
+    previous boundary and logs the average and maximum every
+    CONFIG_GNSS_SAMPLE_LOG_STATS_INTERVAL epochs.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    log_stats_epoch();
+*/
+void log_stats_epoch(void)
+{
+    uint32_t bytes = (uint32_t)atomic_clear(&epoch_bytes);
+
+    /* Boot and modem initialization output is not an epoch. */
+    if (first_epoch)
+    {
+        first_epoch = false;
+        return;
+    }
+
+    epochs++;
+    total_bytes += bytes;
+    max_bytes = MAX(max_bytes, bytes);
+
+    if (epochs < CONFIG_GNSS_SAMPLE_LOG_STATS_INTERVAL)
+    {
+        return;
+    }
+
+    LOG_INF("Log output: %u B/epoch avg, %u B max over %u epochs",
+            total_bytes / epochs, max_bytes, epochs);
+
+    epochs = 0;
+    total_bytes = 0;
+    max_bytes = 0;
+}
+
+/*
+Function : log_stats_output_take
+
+Description :
+    Returns the log bytes output since the previous call, independent of the
+    epoch statistics.
+
+Parameter :
+    void
+
+Return :
+    uint32_t - Number of bytes
+
+Example Call :
+    energy_add_uart_bytes(&account, log_stats_output_take());
+*/
+uint32_t log_stats_output_take(void)
+{
+    return (uint32_t)atomic_clear(&output_bytes);
+}
@@ -0,0 +1,34 @@
+/*
+Name : log_stats.h
+
+Description :
+    Header file for the log output statistics. Declares the hook that marks PVT
+    epoch boundaries so the number of log bytes emitted per epoch can be measured,
+    and the running byte count used for UART energy accounting.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _LOG_STATS_H
+#define _LOG_STATS_H
+
+#include <stdint.h>
+
+#if defined(CONFIG_GNSS_SAMPLE_LOG_STATS)
+void log_stats_epoch(void);
+
+uint32_t log_stats_output_take(void);
+#else
+static inline void log_stats_epoch(void)
+{
+}
+
+static inline uint32_t log_stats_output_take(void)
+{
+    return 0;
+}
+#endif
+
+#endif
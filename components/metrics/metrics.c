@@ -0,0 +1,179 @@
+/*
+Name : metrics.c
+
+Description :
+    This source file implements the application metrics surface: a fixed set of
+    named counters updated by the application modules and reported periodically
+    to the log.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include "metrics.h"
+
+LOG_MODULE_REGISTER(METRICS);
+
+static atomic_t counters[METRICS_COUNT];
+
+static const char *const metric_names[] = {
+    [METRICS_LTE_BLOCKED_EVENTS] = "lte_blocked_events",
+    [METRICS_LTE_BLOCKED_EPOCHS] = "lte_blocked_epochs",
+    [METRICS_WINDOW_TIME_EVENTS] = "window_time_events",
+    [METRICS_WINDOW_TIME_EPOCHS] = "window_time_epochs",
+    [METRICS_SLEEP_EVENTS] = "sleep_events",
+    [METRICS_SLEEP_EPOCHS] = "sleep_epochs",
+    [METRICS_SCHED_DOWNLOAD_EVENTS] = "sched_download_events",
+    [METRICS_SCHED_DOWNLOAD_EPOCHS] = "sched_download_epochs",
+    [METRICS_SCHED_DOWNLOAD_INTERRUPTED] = "sched_download_interrupted",
+    [METRICS_USE_CASE_SWITCHES] = "use_case_switches",
+    [METRICS_TTFF_NORMAL_COUNT] = "ttff_normal_count",
+    [METRICS_TTFF_NORMAL_MS] = "ttff_normal_ms",
+    [METRICS_TTFF_LOW_COUNT] = "ttff_low_count",
+    [METRICS_TTFF_LOW_MS] = "ttff_low_ms",
+    [METRICS_ON_TIME_NORMAL_MS] = "on_time_normal_ms",
+    [METRICS_ON_TIME_LOW_MS] = "on_time_low_ms",
+    [METRICS_EPHEMERIS_REFRESHES] = "ephemeris_refreshes",
+    [METRICS_FIX_DEADLINE_MISSED] = "fix_deadline_missed",
+    [METRICS_FIX_EARLY_MS] = "fix_early_ms",
+};
+
+BUILD_ASSERT(ARRAY_SIZE(metric_names) == METRICS_COUNT, "Missing metric name");
+
+static void report_work_fn(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(report_work, report_work_fn);
+
+/*
+Function : metrics_add
+
+Description :
+    Adds a value to a counter.
+
+Parameter :
+    enum metrics_id id - Counter
+    uint32_t value     - Value to add
+
+Return :
+    void
+
+Example Call :
+    metrics_add(METRICS_LTE_BLOCKED_EPOCHS, 1);
+*/
+void metrics_add(enum metrics_id id, uint32_t value)
+{
+    if (id >= METRICS_COUNT)
+    {
+        return;
+    }
+
+    atomic_add(&counters[id], (atomic_val_t)value);
+}
+
+/*
+Function : metrics_inc
+
+Description :
+    Increments a counter by one.
+
+Parameter :
+    enum metrics_id id - Counter
+
+Return :
+    void
+
+Example Call :
+    metrics_inc(METRICS_LTE_BLOCKED_EVENTS);
+*/
+void metrics_inc(enum metrics_id id)
+{
+    metrics_add(id, 1);
+}
+
+/*
+Function : metrics_get
+
+Description :
+    Returns the current value of a counter.
+
+Parameter :
+    enum metrics_id id - Counter
+
+Return :
+    uint32_t - Counter value, 0 for an unknown counter
+
+Example Call :
+    uint32_t blocked = metrics_get(METRICS_LTE_BLOCKED_EPOCHS);
+*/
+uint32_t metrics_get(enum metrics_id id)
+{
+    if (id >= METRICS_COUNT)
+    {
+        return 0;
+    }
+
+    return (uint32_t)atomic_get(&counters[id]);
+}
+
+/*
+Function : metrics_report
+
+Description :
+    Logs all non-zero counters.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    metrics_report();
+*/
+void metrics_report(void)
+{
+    for (int i = 0; i < METRICS_COUNT; i++)
+    {
+        uint32_t value = metrics_get(i);
+
+        if (value != 0)
+        {
+            LOG_INF("%s: %u", metric_names[i], value);
+        }
+    }
+}
+
+static void report_work_fn(struct k_work *work)
+{
+    metrics_report();
+    k_work_reschedule(k_work_delayable_from_work(work),
+                      K_SECONDS(CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL));
+}
+
+/*
+Function : metrics_init
+
+Description :
+    Starts the periodic metrics report, unless the report interval is zero.
+
+Parameter :
+    void
+
+Return :
+    int - Always returns 0
+
+Example Call :
+    metrics_init();
+*/
+int metrics_init(void)
+{
+    if (CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL > 0)
+    {
+        k_work_schedule(&report_work, K_SECONDS(CONFIG_GNSS_SAMPLE_METRICS_REPORT_INTERVAL));
+    }
+    return 0;
+}
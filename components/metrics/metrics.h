@@ -0,0 +1,53 @@
+/*
+Name : metrics.h
+
+Description :
+    Header file for the application metrics. Declares the counters exported by
+    the application modules and functions to update and report them.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _METRICS_H
+#define _METRICS_H
+
+#include <stdint.h>
+
+enum metrics_id
+{
+    METRICS_LTE_BLOCKED_EVENTS,
+    METRICS_LTE_BLOCKED_EPOCHS,
+    METRICS_WINDOW_TIME_EVENTS,
+    METRICS_WINDOW_TIME_EPOCHS,
+    METRICS_SLEEP_EVENTS,
+    METRICS_SLEEP_EPOCHS,
+    METRICS_SCHED_DOWNLOAD_EVENTS,
+    METRICS_SCHED_DOWNLOAD_EPOCHS,
+    METRICS_SCHED_DOWNLOAD_INTERRUPTED,
+    METRICS_USE_CASE_SWITCHES,
+    METRICS_TTFF_NORMAL_COUNT,
+    METRICS_TTFF_NORMAL_MS,
+    METRICS_TTFF_LOW_COUNT,
+    METRICS_TTFF_LOW_MS,
+    METRICS_ON_TIME_NORMAL_MS,
+    METRICS_ON_TIME_LOW_MS,
+    METRICS_EPHEMERIS_REFRESHES,
+    METRICS_FIX_DEADLINE_MISSED,
+    METRICS_FIX_EARLY_MS,
+
+    METRICS_COUNT
+};
+
+void metrics_add(enum metrics_id id, uint32_t value);
+
+void metrics_inc(enum metrics_id id);
+
+uint32_t metrics_get(enum metrics_id id);
+
+void metrics_report(void);
+
+int metrics_init(void);
+
+#endif
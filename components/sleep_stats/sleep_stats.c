@@ -0,0 +1,230 @@
+/*
+Name : sleep_stats.c
+
+Description :
+    This source file implements the sleep residency statistics. User tracing
+    hooks time every period the CPU spends in the idle thread and record the
+    interrupt that ends it, so for every PVT epoch the idle time, the number of
+    wakeups, the interrupts that caused them and why the GNSS loop itself woke
+    up are known. Averages are logged every CONFIG_GNSS_SAMPLE_SLEEP_STATS_INTERVAL
+    epochs.
+
+    On nRF91 the idle thread sleeps in System ON idle; with the tickless kernel
+    only interrupts wake it, so wakeups per epoch and idle residency show how
+    well the work of an epoch is batched into one burst.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/tracing/tracing.h>
+#include <cmsis_core.h>
+#include "sleep_stats.h"
+
+LOG_MODULE_REGISTER(SLEEP_STATS);
+
+/* Updated by the tracing hooks with interrupts locked or in ISR context. */
+static uint32_t idle_start;
+static bool in_idle;
+static uint64_t idle_cycles;
+static uint32_t wakeups;
+static uint16_t irq_wakeups[CONFIG_NUM_IRQS];
+
+static uint32_t loop_wakeups[SLEEP_STATS_WAKEUPS];
+static uint32_t epoch_start;
+static uint32_t epochs;
+static bool first_epoch = true;
+
+/*
+Function : sys_trace_idle_user
+
+Description :
+    User tracing hook called when the idle thread is about to sleep.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    Called by the kernel.
+*/
+void sys_trace_idle_user(void)
+{
+    idle_start = k_cycle_get_32();
+    in_idle = true;
+}
+
+/*
+Function : sys_trace_isr_enter_user
+
+Description :
+    User tracing hook called on interrupt entry. Ends the idle period, if any,
+    and counts the interrupt as its wakeup source.
+
+Parameter :
+    int nested_interrupts - Interrupt nesting level
+
+Return :
+    void
+
+Example Call :
+    Called by the kernel.
+*/
+void sys_trace_isr_enter_user(int nested_interrupts)
+{
+    ARG_UNUSED(nested_interrupts);
+
+    if (!in_idle)
+    {
+        return;
+    }
+
+    int irq = (int)__get_IPSR() - 16;
+
+    in_idle = false;
+    idle_cycles += k_cycle_get_32() - idle_start;
+    wakeups++;
+    if (irq >= 0 && irq < CONFIG_NUM_IRQS)
+    {
+        irq_wakeups[irq]++;
+    }
+}
+
+/*
+Function : sleep_stats_loop_wakeup
+
+Description :
+    Counts a return of the GNSS loop from k_poll() by its cause.
+
+Parameter :
+    enum sleep_stats_wakeup source - Cause
+
+Return :
+    void
+
+Example Call :
+    sleep_stats_loop_wakeup(SLEEP_STATS_WAKEUP_PVT);
+*/
+void sleep_stats_loop_wakeup(enum sleep_stats_wakeup source)
+{
+    if (source < SLEEP_STATS_WAKEUPS)
+    {
+        loop_wakeups[source]++;
+    }
+}
+
+/*
+Function : report
+
+Description :
+    Logs the idle residency, wakeups and their sources averaged over the
+    epochs since the previous report, and clears the counters.
+
+Parameter :
+    uint32_t elapsed - Cycles since the previous report
+    uint64_t idle    - Idle cycles since the previous report
+    uint32_t count   - CPU wakeups since the previous report
+
+Return :
+    void
+
+Example Call :
+    report(elapsed, idle, count);
+*/
+static void report(uint32_t elapsed, uint64_t idle, uint32_t count)
+{
+    uint32_t idle_permille = elapsed ? (uint32_t)(idle * 1000 / elapsed) : 0;
+
+    LOG_INF("Sleep over %u epochs: %u.%u %% idle, %u ms/epoch awake, "
+            "%u.%02u wakeups/epoch, mean idle %u ms",
+            epochs, idle_permille / 10, idle_permille % 10,
+            k_cyc_to_ms_floor32((elapsed - (uint32_t)idle) / epochs),
+            count / epochs, (count * 100 / epochs) % 100,
+            count ? k_cyc_to_ms_floor32((uint32_t)(idle / count)) : 0);
+
+    LOG_INF("GNSS loop wakeups: %u PVT, %u request, %u timeout",
+            loop_wakeups[SLEEP_STATS_WAKEUP_PVT], loop_wakeups[SLEEP_STATS_WAKEUP_REQUEST],
+            loop_wakeups[SLEEP_STATS_WAKEUP_TIMEOUT]);
+
+    for (int irq = 0; irq < CONFIG_NUM_IRQS; irq++)
+    {
+        unsigned int key = irq_lock();
+        uint16_t n = irq_wakeups[irq];
+
+        irq_wakeups[irq] = 0;
+        irq_unlock(key);
+
+        if (n != 0)
+        {
+            LOG_INF("Wakeups by IRQ %d: %u", irq, n);
+        }
+    }
+
+    memset(loop_wakeups, 0, sizeof(loop_wakeups));
+}
+
+/*
+Function : sleep_stats_epoch
+
+Description :
+    Marks a PVT epoch boundary and logs the statistics every
+    CONFIG_GNSS_SAMPLE_SLEEP_STATS_INTERVAL epochs.
+
+Parameter :
+    void
+
+Return :
+    void
+
+Example Call :
+    sleep_stats_epoch();
+*/
+void sleep_stats_epoch(void)
+{
+    uint32_t now = k_cycle_get_32();
+
+    /* Start measuring at the first epoch, not at boot. */
+    if (first_epoch)
+    {
+        unsigned int key = irq_lock();
+
+        idle_cycles = 0;
+        wakeups = 0;
+        memset(irq_wakeups, 0, sizeof(irq_wakeups));
+        irq_unlock(key);
+
+        memset(loop_wakeups, 0, sizeof(loop_wakeups));
+        epoch_start = now;
+        first_epoch = false;
+
+        if (!IS_ENABLED(CONFIG_TICKLESS_KERNEL))
+        {
+            LOG_WRN("Kernel is not tickless, every system tick wakes the CPU");
+        }
+        return;
+    }
+
+    if (++epochs < CONFIG_GNSS_SAMPLE_SLEEP_STATS_INTERVAL)
+    {
+        return;
+    }
+
+    unsigned int key = irq_lock();
+    uint64_t idle = idle_cycles;
+    uint32_t count = wakeups;
+
+    idle_cycles = 0;
+    wakeups = 0;
+    irq_unlock(key);
+
+    report(now - epoch_start, idle, count);
+
+    epoch_start = now;
+    epochs = 0;
+}
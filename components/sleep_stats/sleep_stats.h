@@ -0,0 +1,41 @@
+/*
+Name : sleep_stats.h
+
+Description :
+    Header file for the sleep residency statistics. Declares the hooks the GNSS
+    loop uses to mark PVT epoch boundaries and to report why it woke up, so the
+    idle time and wakeup sources between epochs can be measured.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _SLEEP_STATS_H
+#define _SLEEP_STATS_H
+
+/* Why the GNSS loop returned from k_poll(). */
+enum sleep_stats_wakeup
+{
+    SLEEP_STATS_WAKEUP_PVT,
+    SLEEP_STATS_WAKEUP_REQUEST,
+    SLEEP_STATS_WAKEUP_TIMEOUT,
+
+    SLEEP_STATS_WAKEUPS
+};
+
+#if defined(CONFIG_GNSS_SAMPLE_SLEEP_STATS)
+void sleep_stats_loop_wakeup(enum sleep_stats_wakeup source);
+
+void sleep_stats_epoch(void);
+#else
+static inline void sleep_stats_loop_wakeup(enum sleep_stats_wakeup source)
+{
+}
+
+static inline void sleep_stats_epoch(void)
+{
+}
+#endif
+
+#endif
@@ -0,0 +1,647 @@
+/*
+Name : sv_history.c
+
+Description :
+    This source file implements the satellite history codec. Every epoch is
+    one record: a length byte followed by a bit-packed payload, so records can
+    be appended to flash pages and walked without decoding them.
+
+        keyframe (1 bit)
+        keyframe : time (64 bits), satellite count (4 bits), every satellite
+        delta    : time, a presence bit per satellite of the previous epoch,
+                   the changes of every satellite still present, the number
+                   of new satellites and every new satellite
+
+    A satellite is matched to the previous epoch by its PRN and signal. A
+    present satellite costs two bits when only its CN0 is unchanged or one
+    bit plus the CN0 difference otherwise; elevation, azimuth and flags are
+    only written when they change. New satellites and keyframes store all
+    fields. The epoch interval is stored as its change from the previous
+    interval, one bit while it is constant.
+
+    Small numbers are written as Exp-Golomb codes (value 0 in 1 bit, 1 to 2
+    in 3 bits, 3 to 6 in 5 bits ...) and signed numbers zigzag mapped first.
+
+    Decoding starts at a keyframe: with a keyframe every keyframe_interval
+    records, a reader can start in the middle of a log and a damaged record
+    only loses the epochs up to the next keyframe. Satellites are decoded in
+    record order (those still present, then new ones), not in the order of
+    the modem's array; the values are exact.
+
+    The file has no Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "sv_history.h"
+
+/* The length byte limits the payload of a record. */
+#define PAYLOAD_MAX_SIZE (SV_HISTORY_RECORD_MAX_SIZE - 1)
+
+struct bit_writer
+{
+    uint8_t *buf;
+    size_t size;
+    size_t bits;
+    bool overflow;
+};
+
+struct bit_reader
+{
+    const uint8_t *buf;
+    size_t size;
+    size_t bits;
+    bool underflow;
+};
+
+/*
+Function : sv_history_init
+
+Description :
+    Initializes an encoder or decoder. The next record encoded is a keyframe.
+
+Parameter :
+    struct sv_history_codec *codec - Codec
+    uint16_t keyframe_interval     - Records from one keyframe to the next, 0 for
+                                     the first record only (encoder only)
+
+Return :
+    void
+
+Example Call :
+    sv_history_init(&codec, 300);
+*/
+void sv_history_init(struct sv_history_codec *codec, uint16_t keyframe_interval)
+{
+    memset(codec, 0, sizeof(*codec));
+    codec->keyframe_interval = keyframe_interval;
+}
+
+/*
+Function : put_bits
+
+Description :
+    Writes the low bits of a value, least significant bit first.
+
+Parameter :
+    struct bit_writer *w - Writer
+    uint32_t value       - Value
+    unsigned int n       - Number of bits, 0 to 32
+
+Return :
+    void
+
+Example Call :
+    put_bits(w, sv->flags, 8);
+*/
+static void put_bits(struct bit_writer *w, uint32_t value, unsigned int n)
+{
+    for (unsigned int i = 0; i < n; i++, w->bits++)
+    {
+        size_t byte = w->bits / 8;
+
+        if (byte >= w->size)
+        {
+            w->overflow = true;
+            return;
+        }
+
+        if (w->bits % 8 == 0)
+        {
+            w->buf[byte] = 0;
+        }
+        w->buf[byte] |= (uint8_t)(((value >> i) & 1) << (w->bits % 8));
+    }
+}
+
+/*
+Function : put_uvar
+
+Description :
+    Writes an unsigned value as an Exp-Golomb code: the bit length of
+    value + 1, minus one, as zero bits, a one bit, and the bits of value + 1
+    below its top bit.
+
+Parameter :
+    struct bit_writer *w - Writer
+    uint32_t value       - Value
+
+Return :
+    void
+
+Example Call :
+    put_uvar(w, new_count);
+*/
+static void put_uvar(struct bit_writer *w, uint32_t value)
+{
+    uint64_t x = (uint64_t)value + 1;
+    unsigned int n = 0;
+
+    while ((x >> n) > 1)
+    {
+        n++;
+    }
+
+    put_bits(w, 0, n);
+    put_bits(w, 1, 1);
+    put_bits(w, (uint32_t)x, n);
+}
+
+/*
+Function : put_svar
+
+Description :
+    Writes a signed value as the Exp-Golomb code of its zigzag mapping
+    (0, -1, 1, -2 ... to 0, 1, 2, 3 ...).
+
+Parameter :
+    struct bit_writer *w - Writer
+    int32_t value        - Value
+
+Return :
+    void
+
+Example Call :
+    put_svar(w, cur->cn0 - prev->cn0);
+*/
+static void put_svar(struct bit_writer *w, int32_t value)
+{
+    put_uvar(w, ((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+/*
+Function : get_bits
+
+Description :
+    Reads bits written by put_bits().
+
+Parameter :
+    struct bit_reader *r - Reader
+    unsigned int n       - Number of bits, 0 to 32
+
+Return :
+    uint32_t - Value, 0 after the end of the payload
+
+Example Call :
+    sv->flags = (uint8_t)get_bits(r, 8);
+*/
+static uint32_t get_bits(struct bit_reader *r, unsigned int n)
+{
+    uint32_t value = 0;
+
+    for (unsigned int i = 0; i < n; i++, r->bits++)
+    {
+        size_t byte = r->bits / 8;
+
+        if (byte >= r->size)
+        {
+            r->underflow = true;
+            return 0;
+        }
+
+        value |= (uint32_t)((r->buf[byte] >> (r->bits % 8)) & 1) << i;
+    }
+
+    return value;
+}
+
+/*
+Function : get_uvar
+
+Description :
+    Reads a value written by put_uvar().
+
+Parameter :
+    struct bit_reader *r - Reader
+
+Return :
+    uint32_t - Value, 0 on a damaged code (underflow is set)
+
+Example Call :
+    uint32_t new_count = get_uvar(r);
+*/
+static uint32_t get_uvar(struct bit_reader *r)
+{
+    unsigned int n = 0;
+
+    while (get_bits(r, 1) == 0)
+    {
+        if (r->underflow || ++n > 32)
+        {
+            r->underflow = true;
+            return 0;
+        }
+    }
+
+    uint64_t x = ((uint64_t)1 << n) | get_bits(r, n);
+
+    if (x - 1 > UINT32_MAX)
+    {
+        r->underflow = true;
+        return 0;
+    }
+
+    return (uint32_t)(x - 1);
+}
+
+/*
+Function : get_svar
+
+Description :
+    Reads a value written by put_svar().
+
+Parameter :
+    struct bit_reader *r - Reader
+
+Return :
+    int32_t - Value
+
+Example Call :
+    int32_t delta = get_svar(r);
+*/
+static int32_t get_svar(struct bit_reader *r)
+{
+    uint32_t z = get_uvar(r);
+
+    return (int32_t)(z >> 1) ^ -(int32_t)(z & 1);
+}
+
+/*
+Function : sv_put
+
+Description :
+    Writes all fields of a satellite, for keyframes and new satellites.
+
+Parameter :
+    struct bit_writer *w           - Writer
+    const struct sv_history_sv *sv - Satellite
+
+Return :
+    void
+
+Example Call :
+    sv_put(w, &epoch->sv[i]);
+*/
+static void sv_put(struct bit_writer *w, const struct sv_history_sv *sv)
+{
+    put_bits(w, sv->sv, 16);
+    put_bits(w, sv->signal, 8);
+    put_bits(w, sv->flags, 8);
+    put_uvar(w, sv->cn0);
+    put_svar(w, sv->elevation);
+    put_svar(w, sv->azimuth);
+}
+
+/*
+Function : sv_get
+
+Description :
+    Reads a satellite written by sv_put().
+
+Parameter :
+    struct bit_reader *r     - Reader
+    struct sv_history_sv *sv - Satellite output
+
+Return :
+    void
+
+Example Call :
+    sv_get(r, &epoch->sv[epoch->count++]);
+*/
+static void sv_get(struct bit_reader *r, struct sv_history_sv *sv)
+{
+    sv->sv = (uint16_t)get_bits(r, 16);
+    sv->signal = (uint8_t)get_bits(r, 8);
+    sv->flags = (uint8_t)get_bits(r, 8);
+    sv->cn0 = (uint16_t)get_uvar(r);
+    sv->elevation = (int16_t)get_svar(r);
+    sv->azimuth = (int16_t)get_svar(r);
+}
+
+/*
+Function : sv_put_delta
+
+Description :
+    Writes the changes of a satellite present in the previous epoch: a bit
+    for a CN0 change and its difference, and a bit for any other change,
+    followed by the changed elevation and azimuth differences or flags.
+
+Parameter :
+    struct bit_writer *w             - Writer
+    const struct sv_history_sv *prev - Satellite in the previous epoch
+    const struct sv_history_sv *cur  - Satellite in this epoch
+
+Return :
+    void
+
+Example Call :
+    sv_put_delta(w, &codec->prev.sv[k], &epoch->sv[j]);
+*/
+static void sv_put_delta(struct bit_writer *w, const struct sv_history_sv *prev,
+                         const struct sv_history_sv *cur)
+{
+    bool geometry = cur->elevation != prev->elevation || cur->azimuth != prev->azimuth;
+    bool flags = cur->flags != prev->flags;
+
+    put_bits(w, cur->cn0 != prev->cn0, 1);
+    if (cur->cn0 != prev->cn0)
+    {
+        put_svar(w, (int32_t)cur->cn0 - prev->cn0);
+    }
+
+    put_bits(w, geometry || flags, 1);
+    if (geometry || flags)
+    {
+        put_bits(w, geometry, 1);
+        if (geometry)
+        {
+            put_svar(w, (int32_t)cur->elevation - prev->elevation);
+            put_svar(w, (int32_t)cur->azimuth - prev->azimuth);
+        }
+
+        put_bits(w, flags, 1);
+        if (flags)
+        {
+            put_bits(w, cur->flags, 8);
+        }
+    }
+}
+
+/*
+Function : sv_get_delta
+
+Description :
+    Reads the changes written by sv_put_delta() and applies them.
+
+Parameter :
+    struct bit_reader *r     - Reader
+    struct sv_history_sv *sv - Satellite, from the previous epoch, updated
+
+Return :
+    void
+
+Example Call :
+    sv_get_delta(r, &next.sv[k]);
+*/
+static void sv_get_delta(struct bit_reader *r, struct sv_history_sv *sv)
+{
+    if (get_bits(r, 1))
+    {
+        sv->cn0 = (uint16_t)(sv->cn0 + get_svar(r));
+    }
+
+    if (get_bits(r, 1))
+    {
+        if (get_bits(r, 1))
+        {
+            sv->elevation = (int16_t)(sv->elevation + get_svar(r));
+            sv->azimuth = (int16_t)(sv->azimuth + get_svar(r));
+        }
+
+        if (get_bits(r, 1))
+        {
+            sv->flags = (uint8_t)get_bits(r, 8);
+        }
+    }
+}
+
+/*
+Function : sv_history_encode
+
+Description :
+    Encodes the satellites of an epoch as a record, a keyframe every
+    keyframe_interval records and when the epoch interval changes by more
+    than an int32 can hold. The codec state only advances on success.
+
+Parameter :
+    struct sv_history_codec *codec        - Encoder
+    const struct sv_history_epoch *epoch  - Epoch, up to SV_HISTORY_MAX_SV satellites
+    uint8_t *buf                          - Output buffer
+    size_t size                           - Output buffer size, SV_HISTORY_RECORD_MAX_SIZE
+                                            always suffices
+
+Return :
+    int - Record length in bytes, -1 if the epoch is invalid or does not fit
+
+Example Call :
+    int len = sv_history_encode(&codec, &epoch, record, sizeof(record));
+*/
+int sv_history_encode(struct sv_history_codec *codec, const struct sv_history_epoch *epoch,
+                      uint8_t *buf, size_t size)
+{
+    struct bit_writer w = {
+        .buf = buf + 1,
+        .size = size < 1 ? 0 : (size - 1 < PAYLOAD_MAX_SIZE ? size - 1 : PAYLOAD_MAX_SIZE),
+    };
+    struct sv_history_epoch next = {.time_ms = epoch->time_ms};
+    bool matched[SV_HISTORY_MAX_SV] = {false};
+    int64_t dt = epoch->time_ms - codec->prev.time_ms;
+    int64_t ddt = dt - codec->dt_ms;
+    bool keyframe = !codec->started || ddt < INT32_MIN || ddt > INT32_MAX ||
+                    (codec->keyframe_interval > 0 &&
+                     codec->since_keyframe >= codec->keyframe_interval);
+
+    if (size < 1 || epoch->count > SV_HISTORY_MAX_SV)
+    {
+        return -1;
+    }
+
+    put_bits(&w, keyframe, 1);
+
+    if (keyframe)
+    {
+        put_bits(&w, (uint32_t)epoch->time_ms, 32);
+        put_bits(&w, (uint32_t)((uint64_t)epoch->time_ms >> 32), 32);
+        put_bits(&w, epoch->count, 4);
+
+        for (uint8_t i = 0; i < epoch->count; i++)
+        {
+            sv_put(&w, &epoch->sv[i]);
+            next.sv[next.count++] = epoch->sv[i];
+        }
+    }
+    else
+    {
+        int8_t match[SV_HISTORY_MAX_SV];
+
+        put_bits(&w, ddt == 0, 1);
+        if (ddt != 0)
+        {
+            put_svar(&w, (int32_t)ddt);
+        }
+
+        for (uint8_t k = 0; k < codec->prev.count; k++)
+        {
+            const struct sv_history_sv *prev = &codec->prev.sv[k];
+
+            match[k] = -1;
+            for (uint8_t j = 0; j < epoch->count && match[k] < 0; j++)
+            {
+                if (!matched[j] && epoch->sv[j].sv == prev->sv &&
+                    epoch->sv[j].signal == prev->signal)
+                {
+                    matched[j] = true;
+                    match[k] = (int8_t)j;
+                }
+            }
+
+            put_bits(&w, match[k] >= 0, 1);
+        }
+
+        for (uint8_t k = 0; k < codec->prev.count; k++)
+        {
+            if (match[k] >= 0)
+            {
+                sv_put_delta(&w, &codec->prev.sv[k], &epoch->sv[match[k]]);
+                next.sv[next.count++] = epoch->sv[match[k]];
+            }
+        }
+
+        put_uvar(&w, (uint32_t)(epoch->count - next.count));
+
+        for (uint8_t j = 0; j < epoch->count; j++)
+        {
+            if (!matched[j])
+            {
+                sv_put(&w, &epoch->sv[j]);
+                next.sv[next.count++] = epoch->sv[j];
+            }
+        }
+    }
+
+    if (w.overflow)
+    {
+        return -1;
+    }
+
+    size_t len = (w.bits + 7) / 8;
+
+    buf[0] = (uint8_t)len;
+
+    codec->prev = next;
+    codec->dt_ms = keyframe ? 0 : dt;
+    codec->since_keyframe = keyframe ? 1 : codec->since_keyframe + 1;
+    codec->started = true;
+
+    return (int)(len + 1);
+}
+
+/*
+Function : sv_history_decode
+
+Description :
+    Decodes a record. Records before the first keyframe cannot be decoded and
+    are skipped; their length is 1 + buf[0].
+
+Parameter :
+    struct sv_history_codec *codec  - Decoder
+    const uint8_t *buf              - Records
+    size_t len                      - Bytes available
+    struct sv_history_epoch *epoch  - Epoch output
+
+Return :
+    int - Record length in bytes, 0 if the record was skipped, -1 if it is
+          damaged or truncated (the decoder then waits for a keyframe)
+
+Example Call :
+    int n = sv_history_decode(&codec, log + offset, log_len - offset, &epoch);
+*/
+int sv_history_decode(struct sv_history_codec *codec, const uint8_t *buf, size_t len,
+                      struct sv_history_epoch *epoch)
+{
+    struct bit_reader r = {.buf = buf + 1};
+    struct sv_history_epoch next = {0};
+
+    if (len < 1 || (size_t)buf[0] + 1 > len)
+    {
+        codec->started = false;
+        return -1;
+    }
+    r.size = buf[0];
+
+    bool keyframe = get_bits(&r, 1);
+
+    if (keyframe)
+    {
+        uint64_t lo = get_bits(&r, 32);
+        uint64_t hi = get_bits(&r, 32);
+
+        next.time_ms = (int64_t)(lo | hi << 32);
+        next.count = (uint8_t)get_bits(&r, 4);
+        if (next.count > SV_HISTORY_MAX_SV)
+        {
+            r.underflow = true;
+        }
+
+        for (uint8_t i = 0; i < next.count && !r.underflow; i++)
+        {
+            sv_get(&r, &next.sv[i]);
+        }
+    }
+    else if (!codec->started)
+    {
+        return 0;
+    }
+    else
+    {
+        bool present[SV_HISTORY_MAX_SV];
+        int64_t dt = codec->dt_ms;
+
+        if (get_bits(&r, 1) == 0)
+        {
+            dt += get_svar(&r);
+        }
+        next.time_ms = codec->prev.time_ms + dt;
+
+        for (uint8_t k = 0; k < codec->prev.count; k++)
+        {
+            present[k] = get_bits(&r, 1);
+        }
+
+        for (uint8_t k = 0; k < codec->prev.count; k++)
+        {
+            if (present[k])
+            {
+                next.sv[next.count] = codec->prev.sv[k];
+                sv_get_delta(&r, &next.sv[next.count++]);
+            }
+        }
+
+        uint32_t new_count = get_uvar(&r);
+
+        if (new_count > (uint32_t)(SV_HISTORY_MAX_SV - next.count))
+        {
+            r.underflow = true;
+        }
+
+        for (uint32_t i = 0; i < new_count && !r.underflow; i++)
+        {
+            sv_get(&r, &next.sv[next.count++]);
+        }
+
+        codec->dt_ms = dt;
+    }
+
+    if (r.underflow)
+    {
+        codec->started = false;
+        return -1;
+    }
+
+    if (keyframe)
+    {
+        codec->dt_ms = 0;
+    }
+
+    codec->prev = next;
+    codec->started = true;
+    *epoch = next;
+
+    return buf[0] + 1;
+}
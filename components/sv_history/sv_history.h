@@ -0,0 +1,63 @@
+/*
+Name : sv_history.h
+
+Description :
+    Header file for the satellite history codec. Declares a compact record
+    format for the tracked satellites of every PVT epoch, storing only what
+    changed since the previous epoch, and its encoder and decoder.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _SV_HISTORY_H
+#define _SV_HISTORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Same as NRF_MODEM_GNSS_MAX_SATELLITES. */
+#define SV_HISTORY_MAX_SV 12
+
+/* Largest record, a keyframe of SV_HISTORY_MAX_SV satellites with any values. */
+#define SV_HISTORY_RECORD_MAX_SIZE 256
+
+/* One tracked satellite, the fields of struct nrf_modem_gnss_sv. */
+struct sv_history_sv
+{
+    uint16_t sv;
+    uint8_t signal;
+    uint8_t flags;
+    uint16_t cn0; /* 0.1 dB-Hz */
+    int16_t elevation;
+    int16_t azimuth;
+};
+
+struct sv_history_epoch
+{
+    int64_t time_ms;
+    uint8_t count;
+    struct sv_history_sv sv[SV_HISTORY_MAX_SV];
+};
+
+/* Encoder or decoder state: the previous epoch that records refer to. */
+struct sv_history_codec
+{
+    struct sv_history_epoch prev;
+    int64_t dt_ms;
+    uint16_t keyframe_interval;
+    uint16_t since_keyframe;
+    bool started;
+};
+
+void sv_history_init(struct sv_history_codec *codec, uint16_t keyframe_interval);
+
+int sv_history_encode(struct sv_history_codec *codec, const struct sv_history_epoch *epoch,
+                      uint8_t *buf, size_t size);
+
+int sv_history_decode(struct sv_history_codec *codec, const uint8_t *buf, size_t len,
+                      struct sv_history_epoch *epoch);
+
+#endif
@@ -0,0 +1,61 @@
+/*
+Name : sv_table.c
+
+Description :
+    This source file defines the satellite classification table. The entries
+    are generated by the preprocessor from the PRN ranges in sv_table.h, so
+    the table is constant data in flash and needs no initialization: every
+    PRN below SV_TABLE_PRN_COUNT has an entry, and those outside the GPS and
+    QZSS ranges (including 0, an empty modem slot) are SV_TABLE_NONE with the
+    out of range index SV_TABLE_SV_COUNT. Compact indices number GPS first,
+    then QZSS. The file has no Zephyr dependencies so it can be used by the
+    host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdint.h>
+#include "sv_table.h"
+
+#define QZSS_INDEX_FIRST (SV_TABLE_GPS_PRN_LAST - SV_TABLE_GPS_PRN_FIRST + 1)
+
+#define NONE {SV_TABLE_NONE, SV_TABLE_SIGNAL_NONE, SV_TABLE_SV_COUNT}
+#define NONE_2 NONE, NONE
+#define NONE_8 NONE_2, NONE_2, NONE_2, NONE_2
+#define NONE_32 NONE_8, NONE_8, NONE_8, NONE_8
+
+#define GPS(prn) {SV_TABLE_GPS, SV_TABLE_SIGNAL_GPS_L1CA, (prn) - SV_TABLE_GPS_PRN_FIRST}
+#define GPS_4(prn) GPS(prn), GPS((prn) + 1), GPS((prn) + 2), GPS((prn) + 3)
+#define GPS_16(prn) GPS_4(prn), GPS_4((prn) + 4), GPS_4((prn) + 8), GPS_4((prn) + 12)
+
+#define QZSS(prn)                                                                \
+    {SV_TABLE_QZSS, SV_TABLE_SIGNAL_QZSS_L1CA,                                   \
+     QZSS_INDEX_FIRST + (prn) - SV_TABLE_QZSS_PRN_FIRST}
+#define QZSS_2(prn) QZSS(prn), QZSS((prn) + 1)
+
+/* The ranges below must match the PRN ranges in sv_table.h. */
+_Static_assert(SV_TABLE_GPS_PRN_FIRST == 1 && SV_TABLE_GPS_PRN_LAST == 32,
+               "GPS entries cover PRN 1-32");
+_Static_assert(SV_TABLE_QZSS_PRN_LAST - SV_TABLE_QZSS_PRN_FIRST + 1 == 10,
+               "QZSS entries cover 10 PRNs");
+_Static_assert(SV_TABLE_QZSS_PRN_FIRST - SV_TABLE_GPS_PRN_LAST - 1 == 5 * 32,
+               "Unknown entries cover 160 PRNs between GPS and QZSS");
+_Static_assert(SV_TABLE_SV_COUNT < UINT8_MAX, "Compact index fits the entry");
+
+const struct sv_table_entry sv_table[SV_TABLE_PRN_COUNT] = {
+    NONE,
+    GPS_16(1),
+    GPS_16(17),
+    NONE_32,
+    NONE_32,
+    NONE_32,
+    NONE_32,
+    NONE_32,
+    QZSS_2(193),
+    QZSS_2(195),
+    QZSS_2(197),
+    QZSS_2(199),
+    QZSS_2(201),
+};
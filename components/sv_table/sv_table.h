@@ -0,0 +1,79 @@
+/*
+Name : sv_table.h
+
+Description :
+    Header file for the satellite classification tables. Declares a table
+    built at compile time that maps every PRN the modem reports to its
+    constellation, its signal and an index into compact per-satellite arrays,
+    so classifying a satellite is one lookup instead of a chain of PRN range
+    and flag checks. Lookups take the signal the modem reports with the PRN,
+    PRN ranges of different constellations overlap.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _SV_TABLE_H
+#define _SV_TABLE_H
+
+#include <stdint.h>
+
+/* GPS PRN 1-32 and QZSS PRN 193-202. */
+#define SV_TABLE_GPS_PRN_FIRST 1
+#define SV_TABLE_GPS_PRN_LAST 32
+#define SV_TABLE_QZSS_PRN_FIRST 193
+#define SV_TABLE_QZSS_PRN_LAST 202
+
+/* Entries in the PRN table, PRNs at or above are not known. */
+#define SV_TABLE_PRN_COUNT (SV_TABLE_QZSS_PRN_LAST + 1)
+
+/* Known satellites, the size of arrays indexed by sv_table_index(). */
+#define SV_TABLE_SV_COUNT                                         \
+    ((SV_TABLE_GPS_PRN_LAST - SV_TABLE_GPS_PRN_FIRST + 1) +       \
+     (SV_TABLE_QZSS_PRN_LAST - SV_TABLE_QZSS_PRN_FIRST + 1))
+
+/* Signal types of struct nrf_modem_gnss_sv. */
+#define SV_TABLE_SIGNAL_NONE 0
+#define SV_TABLE_SIGNAL_GPS_L1CA 1
+#define SV_TABLE_SIGNAL_QZSS_L1CA 3
+
+enum sv_table_constellation
+{
+    SV_TABLE_NONE, /* Empty slot or unknown PRN */
+    SV_TABLE_GPS,
+    SV_TABLE_QZSS,
+    SV_TABLE_CONSTELLATIONS,
+};
+
+struct sv_table_entry
+{
+    uint8_t constellation; /* enum sv_table_constellation */
+    uint8_t signal;        /* SV_TABLE_SIGNAL_* */
+    uint8_t index;         /* Compact index, SV_TABLE_SV_COUNT if unknown */
+};
+
+extern const struct sv_table_entry sv_table[SV_TABLE_PRN_COUNT];
+
+/* Entry of a PRN received on a signal, the SV_TABLE_NONE entry of PRN 0 for
+ * unknown PRNs and for a PRN of another constellation than the tabled one. */
+static inline const struct sv_table_entry *sv_table_get(uint16_t sv, uint8_t signal)
+{
+    const struct sv_table_entry *entry = &sv_table[sv < SV_TABLE_PRN_COUNT ? sv : 0];
+
+    return entry->signal == signal ? entry : &sv_table[0];
+}
+
+/* Nonzero for a satellite of a known constellation, 0 for an empty slot. */
+static inline uint8_t sv_table_known(uint16_t sv, uint8_t signal)
+{
+    return sv_table_get(sv, signal)->constellation != SV_TABLE_NONE;
+}
+
+/* Compact index of a satellite, SV_TABLE_SV_COUNT if it is not known. */
+static inline uint8_t sv_table_index(uint16_t sv, uint8_t signal)
+{
+    return sv_table_get(sv, signal)->index;
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*
+Name : ttff_model.c
+
+Description :
+    This source file implements the TTFF prediction model. An acquisition is
+    classified by start type, from the number of satellites with a usable
+    ephemeris and the time since the last fix, and by environment, from the
+    satellites used in the last fix (few satellites means an obstructed sky).
+    Each of the resulting cells keeps an exponential moving average of the
+    observed TTFF and of its absolute deviation, starting from typical nRF91
+    values, so the model adapts to the device's environment history.
+
+    The prediction is the mean plus margin deviations; a scheduler picks the
+    margin to trade missed deadlines against GNSS on-time. The file has no
+    Zephyr dependencies so it can be used by the host tools.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include "ttff_model.h"
+
+/* Weight of a new observation in the moving averages. */
+#define ALPHA 0.2f
+
+/* Fewer satellites used in the last fix than this means an obstructed sky. */
+#define OBSTRUCTED_SV 6
+
+/* The receiver time and position are good enough for a warm start for this
+ * long after a fix. */
+#define WARM_START_MAX_S (4 * 3600)
+
+/* Starting values in ms, open sky and obstructed. */
+static const float prior_ms[TTFF_START_COUNT][2] = {
+    [TTFF_START_HOT] = {2000.0f, 5000.0f},
+    [TTFF_START_WARM] = {32000.0f, 60000.0f},
+    [TTFF_START_COLD] = {45000.0f, 90000.0f},
+};
+
+/*
+Function : ttff_model_init
+
+Description :
+    Initializes the model with the typical TTFF of each cell.
+
+Parameter :
+    struct ttff_model *model - Model
+    uint8_t min_sv           - Usable ephemerides needed for a hot start
+
+Return :
+    void
+
+Example Call :
+    ttff_model_init(&model, CONFIG_GNSS_SAMPLE_EPHEMERIS_MIN_SV);
+*/
+void ttff_model_init(struct ttff_model *model, uint8_t min_sv)
+{
+    model->min_sv = min_sv;
+
+    for (int s = 0; s < TTFF_START_COUNT; s++)
+    {
+        for (int e = 0; e < 2; e++)
+        {
+            model->cell[s][e].mean_ms = prior_ms[s][e];
+            model->cell[s][e].dev_ms = prior_ms[s][e] / 2.0f;
+        }
+    }
+}
+
+/*
+Function : ttff_start_type
+
+Description :
+    Classifies an acquisition as a hot, warm or cold start.
+
+Parameter :
+    const struct ttff_model *model       - Model
+    const struct ttff_features *features - Acquisition features
+
+Return :
+    enum ttff_start - Start type
+
+Example Call :
+    enum ttff_start type = ttff_start_type(&model, &features);
+*/
+enum ttff_start ttff_start_type(const struct ttff_model *model,
+                                const struct ttff_features *features)
+{
+    if (features->since_fix_s == TTFF_NO_FIX)
+    {
+        return TTFF_START_COLD;
+    }
+
+    if (features->eph_valid >= model->min_sv)
+    {
+        return TTFF_START_HOT;
+    }
+
+    return features->since_fix_s < WARM_START_MAX_S ? TTFF_START_WARM : TTFF_START_COLD;
+}
+
+/*
+Function : obstructed_get
+
+Description :
+    Returns the obstruction index of the model cell of an acquisition, the
+    second index next to its start type.
+
+Parameter :
+    const struct ttff_features *features - Acquisition features
+
+Return :
+    int - 1 if the sky was obstructed at the last fix, 0 otherwise
+
+Example Call :
+    cell = &model->cell[ttff_start_type(model, features)][obstructed_get(features)];
+*/
+static int obstructed_get(const struct ttff_features *features)
+{
+    return features->since_fix_s != TTFF_NO_FIX && features->sv_used < OBSTRUCTED_SV;
+}
+
+/*
+Function : ttff_model_predict
+
+Description :
+    Predicts the TTFF of an acquisition.
+
+Parameter :
+    const struct ttff_model *model       - Model
+    const struct ttff_features *features - Acquisition features
+    float margin                         - Deviations added to the mean
+
+Return :
+    uint32_t - Predicted TTFF in ms
+
+Example Call :
+    uint32_t lead_ms = ttff_model_predict(&model, &features, 2.0f);
+*/
+uint32_t ttff_model_predict(const struct ttff_model *model,
+                            const struct ttff_features *features, float margin)
+{
+    const struct ttff_cell *cell =
+        &model->cell[ttff_start_type(model, features)][obstructed_get(features)];
+    float ttff = cell->mean_ms + margin * cell->dev_ms;
+
+    return ttff > 0.0f ? (uint32_t)ttff : 0;
+}
+
+/*
+Function : ttff_model_update
+
+Description :
+    Learns from the observed TTFF of an acquisition.
+
+Parameter :
+    struct ttff_model *model             - Model
+    const struct ttff_features *features - Features when the acquisition started
+    uint32_t ttff_ms                     - Observed TTFF in ms
+
+Return :
+    void
+
+Example Call :
+    ttff_model_update(&model, &features, ttff_ms);
+*/
+void ttff_model_update(struct ttff_model *model, const struct ttff_features *features,
+                       uint32_t ttff_ms)
+{
+    struct ttff_cell *cell =
+        &model->cell[ttff_start_type(model, features)][obstructed_get(features)];
+    float error = (float)ttff_ms - cell->mean_ms;
+
+    cell->mean_ms += ALPHA * error;
+    cell->dev_ms += ALPHA * (fabsf(error) - cell->dev_ms);
+}
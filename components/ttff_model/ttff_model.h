@@ -0,0 +1,62 @@
+/*
+Name : ttff_model.h
+
+Description :
+    Header file for the time to first fix (TTFF) prediction model. Declares the
+    features known before an acquisition starts and the functions predicting
+    the TTFF from them and learning from the observed TTFF.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _TTFF_MODEL_H
+#define _TTFF_MODEL_H
+
+#include <stdint.h>
+
+#define TTFF_NO_FIX UINT32_MAX
+
+enum ttff_start
+{
+    TTFF_START_HOT,  /* Enough usable ephemerides */
+    TTFF_START_WARM, /* Time and position known, ephemerides to decode */
+    TTFF_START_COLD, /* Nothing known */
+    TTFF_START_COUNT,
+};
+
+/* Known when the acquisition starts. */
+struct ttff_features
+{
+    uint32_t since_fix_s; /* Time since the last fix, TTFF_NO_FIX if none */
+    uint8_t eph_valid;    /* Satellites with a usable ephemeris */
+    uint8_t sv_used;      /* Satellites used in the last fix */
+};
+
+/* Running mean and mean absolute deviation of the TTFF, in ms. */
+struct ttff_cell
+{
+    float mean_ms;
+    float dev_ms;
+};
+
+struct ttff_model
+{
+    uint8_t min_sv;
+    /* Per start type, open sky [0] and obstructed [1] environment. */
+    struct ttff_cell cell[TTFF_START_COUNT][2];
+};
+
+void ttff_model_init(struct ttff_model *model, uint8_t min_sv);
+
+enum ttff_start ttff_start_type(const struct ttff_model *model,
+                                const struct ttff_features *features);
+
+uint32_t ttff_model_predict(const struct ttff_model *model,
+                            const struct ttff_features *features, float margin);
+
+void ttff_model_update(struct ttff_model *model, const struct ttff_features *features,
+                       uint32_t ttff_ms);
+
+#endif
@@ -4,25 +4,35 @@
 #include <zephyr/logging/log.h>
 #include "nrf91_modem.h"
 #include "gnss.h"
+#include "gnss_bus.h"
+#include "gnss_sm.h"
+#include "metrics.h"
+#include "energy_monitor.h"
+#include "fast_trig.h"
 
 LOG_MODULE_REGISTER(MAIN);
 
-extern bool ref_used;
-extern double ref_latitude;
-extern double ref_longitude;
+#if defined(CONFIG_GNSS_SAMPLE_HEAP_FREE)
+BUILD_ASSERT(CONFIG_HEAP_MEM_POOL_SIZE == 0,
+	     "CONFIG_GNSS_SAMPLE_HEAP_FREE requires CONFIG_HEAP_MEM_POOL_SIZE=0");
+#endif
 
 int main(void)
 {
 
 	LOG_INF("Starting GNS Based Location Tracking\n\r");
 
+	if (IS_ENABLED(CONFIG_GNSS_SAMPLE_TRIG_BENCHMARK))
+	{
+		fast_trig_bench();
+	}
+
 	/* Initialize reference coordinates (if used). */
 	if (sizeof(CONFIG_GNSS_SAMPLE_REFERENCE_LATITUDE) > 1 &&
 		sizeof(CONFIG_GNSS_SAMPLE_REFERENCE_LONGITUDE) > 1)
 	{
-		ref_used = true;
-		ref_latitude = atof(CONFIG_GNSS_SAMPLE_REFERENCE_LATITUDE);
-		ref_longitude = atof(CONFIG_GNSS_SAMPLE_REFERENCE_LONGITUDE);
+		gnss_reference_set(atof(CONFIG_GNSS_SAMPLE_REFERENCE_LATITUDE),
+				   atof(CONFIG_GNSS_SAMPLE_REFERENCE_LONGITUDE));
 	}
 
 	if (modem_init() != 0)
@@ -31,15 +41,24 @@ int main(void)
 		return -1;
 	}
 
-	if (gnss_init_and_start() != 0)
+	metrics_init();
+	energy_monitor_init();
+
+	if (gnss_bus_init() != 0)
+	{
+		LOG_ERR("Failed to initialize GNSS bus");
+		return -1;
+	}
+
+	if (gnss_sm_init() != 0)
 	{
-		LOG_ERR("Failed to initialize and start GNSS");
+		LOG_ERR("Failed to initialize GNSS state machine");
 		return -1;
 	}
 
 	while (1)
 	{
-		gnss_start_searching();
+		gnss_sm_run();
 	}
 
 	return 0;
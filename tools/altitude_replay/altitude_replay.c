@@ -0,0 +1,177 @@
+/*
+Name : altitude_replay.c
+
+Description :
+    Host replay harness for components/altitude. Simulates a device walking up
+    and down the floors of a building with GNSS altitude (slowly wandering and
+    white errors, reported accuracy, vertical speed) and a barometer (noise,
+    quantization and weather drift), and compares the raw GNSS altitude with
+    the filter fed GNSS only and GNSS plus barometer on altitude error, error
+    of the altitude change over a minute (floor changes), climb rate error and
+    the share of epochs on the right floor.
+
+    Build and run:
+        cc -O2 -I../../components/altitude altitude_replay.c \
+            ../../components/altitude/altitude.c -lm -o altitude_replay
+        ./altitude_replay
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "altitude.h"
+
+#define DURATION_S (4 * 3600)
+#define GROUND_M 120.0
+#define FLOOR_M 3.5
+#define FLOORS 8
+#define STAIRS_SPEED 0.3 /* m/s */
+
+/* GNSS altitude error: first order Gauss-Markov plus white noise. */
+#define GNSS_WANDER_M 8.0
+#define GNSS_WANDER_TAU_S 120.0
+#define GNSS_WHITE_M 3.0
+#define GNSS_ACCURACY_M 10.0f
+#define GNSS_VSPEED_NOISE 0.3
+#define GNSS_VSPEED_ACCURACY 0.5f
+
+/* Barometer: noise, 1 Pa resolution and 100 Pa per hour weather change. */
+#define BARO_NOISE_PA 3.0
+#define BARO_DRIFT_PA_PER_S (100.0 / 3600.0)
+
+#define ACCEL_NOISE 0.5f
+#define BIAS_DRIFT 0.01f
+
+/* Altitude change over this window, how well floor changes are seen. */
+#define CHANGE_WINDOW_S 60
+
+struct result
+{
+    double alt_sq;
+    double climb_sq;
+    double change_sq;
+    int floor_ok;
+    int count;
+    double history[CHANGE_WINDOW_S]; /* Error over the last window */
+};
+
+static double gaussian(void)
+{
+    double u1 = (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+    double u2 = (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static double pressure_at(double altitude)
+{
+    return 101325.0 * pow(1.0 - altitude / 44330.0, 5.255);
+}
+
+static void score(struct result *r, double altitude, double climb, double true_alt,
+                  double true_climb)
+{
+    double err = altitude - true_alt;
+    double *old = &r->history[r->count % CHANGE_WINDOW_S];
+
+    if (r->count >= CHANGE_WINDOW_S)
+    {
+        r->change_sq += (err - *old) * (err - *old);
+    }
+    *old = err;
+
+    r->alt_sq += err * err;
+    r->climb_sq += (climb - true_climb) * (climb - true_climb);
+    r->floor_ok += fabs(err) < FLOOR_M / 2;
+    r->count++;
+}
+
+static void print(const char *name, const struct result *r)
+{
+    printf("%-18s %10.2f %14.2f %14.3f %11.1f\n", name, sqrt(r->alt_sq / r->count),
+           sqrt(r->change_sq / (r->count - CHANGE_WINDOW_S)), sqrt(r->climb_sq / r->count),
+           100.0 * r->floor_ok / r->count);
+}
+
+int main(void)
+{
+    struct altitude_filter gnss_only;
+    struct altitude_filter fused;
+    struct result raw = {0}, filtered = {0}, baro = {0};
+    double wander = 0.0;
+    double true_alt = GROUND_M;
+    int floor = 0, target = 0;
+    int dwell = 0;
+
+    srand(1);
+    altitude_init(&gnss_only, ACCEL_NOISE, BIAS_DRIFT);
+    altitude_init(&fused, ACCEL_NOISE, BIAS_DRIFT);
+
+    for (int t = 0; t < DURATION_S; t++)
+    {
+        /* Stay on a floor for 2 to 10 minutes, then take the stairs. */
+        double true_climb = 0.0;
+
+        if (floor == target)
+        {
+            if (--dwell <= 0)
+            {
+                target = rand() % FLOORS;
+                dwell = 120 + rand() % 480;
+            }
+        }
+        else
+        {
+            double goal = GROUND_M + target * FLOOR_M;
+
+            true_climb = goal > true_alt ? STAIRS_SPEED : -STAIRS_SPEED;
+            true_alt += true_climb;
+            if (fabs(goal - true_alt) < STAIRS_SPEED)
+            {
+                true_alt = goal;
+                floor = target;
+            }
+        }
+
+        double phi = exp(-1.0 / GNSS_WANDER_TAU_S);
+
+        wander = phi * wander + sqrt(1.0 - phi * phi) * GNSS_WANDER_M * gaussian();
+
+        float gnss_alt = (float)(true_alt + wander + GNSS_WHITE_M * gaussian());
+        float vspeed = (float)(true_climb + GNSS_VSPEED_NOISE * gaussian());
+        float pressure = (float)round(pressure_at(true_alt) + BARO_DRIFT_PA_PER_S * t +
+                                      BARO_NOISE_PA * gaussian());
+        int64_t now = (int64_t)t * 1000;
+
+        altitude_update_gnss(&gnss_only, now, gnss_alt, GNSS_ACCURACY_M, vspeed,
+                             GNSS_VSPEED_ACCURACY);
+        altitude_update_baro(&fused, now, pressure);
+        altitude_update_gnss(&fused, now, gnss_alt, GNSS_ACCURACY_M, vspeed,
+                             GNSS_VSPEED_ACCURACY);
+
+        /* Skip the first minutes while the filters settle. */
+        if (t < 300)
+        {
+            continue;
+        }
+
+        score(&raw, gnss_alt, vspeed, true_alt, true_climb);
+        score(&filtered, altitude_get(&gnss_only), altitude_climb_rate_get(&gnss_only),
+              true_alt, true_climb);
+        score(&baro, altitude_get(&fused), altitude_climb_rate_get(&fused), true_alt,
+              true_climb);
+    }
+
+    printf("%d h at 1 Hz, %d floors of %.1f m\n\n", DURATION_S / 3600, FLOORS, FLOOR_M);
+    printf("%-18s %10s %14s %14s %11s\n", "estimator", "RMS alt m", "RMS 1 min m",
+           "RMS climb m/s", "floor ok %");
+    print("GNSS raw", &raw);
+    print("filter, GNSS", &filtered);
+    print("filter, GNSS+baro", &baro);
+
+    return 0;
+}
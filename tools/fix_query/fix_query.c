@@ -0,0 +1,253 @@
+/*
+Name : fix_query.c
+
+Description :
+    Queries a fix store (tools/fix_store) written by tools/ingest_server:
+    selects the fixes inside a time window, a latitude/longitude box, of one
+    device, up to an accuracy and from a number of satellites, and prints
+    their count, time span and mean accuracy, altitude and satellites used.
+
+    The store is mapped and scanned block by block; only the filter columns
+    and the columns of the summary are decoded, and blocks outside the
+    filters are skipped by their minimum and maximum. The store size and the
+    scan time (best of -n runs) are printed to stderr. Build with -O3 so the
+    scan loops are vectorized.
+
+    Build and run:
+        cc -O3 -march=native -pthread -I../fix_store -I../../components/fix_codec \
+            -I../../components/gnss_time fix_query.c ../fix_store/fix_store.c \
+            ../../components/gnss_time/gnss_time.c -lm -o fix_query
+        ./fix_query <store dir> [-t from,to] [-b lat_min,lon_min,lat_max,lon_max]
+            [-d device] [-a max accuracy] [-s min satellites] [-n runs]
+        (times as YYYY-MM-DDThh:mm:ss UTC, accuracy in meters)
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fix_store.h"
+#include "gnss_time.h"
+
+#define MAX_RANGES 8
+
+struct summary
+{
+    uint64_t count;
+    int64_t first_ms;
+    int64_t last_ms;
+    int64_t accuracy_dm;
+    int64_t altitude_cm;
+    int64_t sv_used;
+};
+
+static double elapsed_ms(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static int parse_utc(const char *s, int64_t *utc_ms)
+{
+    unsigned int year, month, day, hour, minute, seconds;
+
+    if (sscanf(s, "%u-%u-%uT%u:%u:%u", &year, &month, &day, &hour, &minute, &seconds) != 6)
+    {
+        return -1;
+    }
+
+    *utc_ms = gnss_time_utc_ms((uint16_t)year, (uint8_t)month, (uint8_t)day, (uint8_t)hour,
+                               (uint8_t)minute, (uint8_t)seconds, 0);
+    return 0;
+}
+
+static void format_utc(int64_t utc_ms, char *buf, size_t size)
+{
+    time_t seconds = (time_t)(utc_ms / 1000);
+    struct tm tm;
+
+    if (gmtime_r(&seconds, &tm) == NULL)
+    {
+        snprintf(buf, size, "-");
+        return;
+    }
+
+    snprintf(buf, size, "%04d-%02d-%02dT%02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1,
+             tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+}
+
+static void add_range(struct fix_store_range *ranges, size_t *count,
+                      enum fix_store_column column, int64_t min, int64_t max)
+{
+    ranges[(*count)++] = (struct fix_store_range){.column = column, .min = min, .max = max};
+}
+
+/* Sums the selected rows without branches, so the loops vectorize. */
+static void summarize(const struct fix_store_vector *v, void *ctx)
+{
+    struct summary *s = ctx;
+    const int64_t *time = v->values[FIX_STORE_TIME];
+    int64_t first = INT64_MAX;
+    int64_t last = INT64_MIN;
+    int64_t accuracy = 0;
+    int64_t altitude = 0;
+    int64_t sv_used = 0;
+
+    for (uint32_t i = 0; i < v->rows; i++)
+    {
+        int64_t selected = v->selection[i];
+
+        accuracy += selected * v->values[FIX_STORE_ACCURACY][i];
+        altitude += selected * v->values[FIX_STORE_ALTITUDE][i];
+        sv_used += selected * v->values[FIX_STORE_SV_USED][i];
+        first = selected && time[i] < first ? time[i] : first;
+        last = selected && time[i] > last ? time[i] : last;
+    }
+
+    s->count += v->selected;
+    s->accuracy_dm += accuracy;
+    s->altitude_cm += altitude;
+    s->sv_used += sv_used;
+    s->first_ms = first < s->first_ms ? first : s->first_ms;
+    s->last_ms = last > s->last_ms ? last : s->last_ms;
+}
+
+int main(int argc, char **argv)
+{
+    struct fix_store_range ranges[MAX_RANGES];
+    struct fix_store_reader reader;
+    struct fix_store_scan_stats stats;
+    struct summary summary;
+    struct timespec start;
+    size_t range_count = 0;
+    long runs = 1;
+    double best_ms = INFINITY;
+    char from[80], to[80];
+
+    if (argc < 2 || argc % 2 != 0)
+    {
+        fprintf(stderr,
+                "usage: %s <store dir> [-t from,to] [-b lat_min,lon_min,lat_max,lon_max]\n"
+                "       [-d device] [-a max accuracy] [-s min satellites] [-n runs]\n",
+                argv[0]);
+        return 1;
+    }
+
+    for (int i = 2; i < argc; i += 2)
+    {
+        const char *arg = argv[i + 1];
+        const char *comma = strchr(arg, ',');
+        double lat_min, lon_min, lat_max, lon_max;
+        int64_t t0, t1;
+
+        if (strcmp(argv[i], "-t") == 0 && comma != NULL && parse_utc(arg, &t0) == 0 &&
+            parse_utc(comma + 1, &t1) == 0)
+        {
+            add_range(ranges, &range_count, FIX_STORE_TIME, t0, t1 - 1);
+        }
+        else if (strcmp(argv[i], "-b") == 0 &&
+                 sscanf(arg, "%lf,%lf,%lf,%lf", &lat_min, &lon_min, &lat_max, &lon_max) == 4)
+        {
+            add_range(ranges, &range_count, FIX_STORE_LATITUDE, llround(lat_min * 1e7),
+                      llround(lat_max * 1e7));
+            add_range(ranges, &range_count, FIX_STORE_LONGITUDE, llround(lon_min * 1e7),
+                      llround(lon_max * 1e7));
+        }
+        else if (strcmp(argv[i], "-d") == 0)
+        {
+            int64_t device = strtoll(arg, NULL, 10);
+
+            add_range(ranges, &range_count, FIX_STORE_DEVICE, device, device);
+        }
+        else if (strcmp(argv[i], "-a") == 0)
+        {
+            add_range(ranges, &range_count, FIX_STORE_ACCURACY, 0,
+                      llround(strtod(arg, NULL) * 10.0));
+        }
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            add_range(ranges, &range_count, FIX_STORE_SV_USED, strtoll(arg, NULL, 10),
+                      INT64_MAX);
+        }
+        else if (strcmp(argv[i], "-n") == 0)
+        {
+            runs = strtol(arg, NULL, 10);
+        }
+        else
+        {
+            fprintf(stderr, "invalid option %s %s\n", argv[i], arg);
+            return 1;
+        }
+
+        if (range_count > MAX_RANGES - 2)
+        {
+            fprintf(stderr, "too many filters\n");
+            return 1;
+        }
+    }
+
+    if (fix_store_reader_open(&reader, argv[1]) != 0)
+    {
+        fprintf(stderr, "%s: cannot open or not a fix store\n", argv[1]);
+        return 1;
+    }
+
+    uint64_t raw = 0;
+
+    for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+    {
+        raw += reader.rows * fix_store_column_width((enum fix_store_column)c);
+    }
+
+    fprintf(stderr, "%llu fixes in %llu blocks, %.1f MB (%.1f MB uncompressed, %.1fx)\n",
+            (unsigned long long)reader.rows, (unsigned long long)reader.block_count,
+            reader.bytes / 1e6, raw / 1e6, reader.bytes > 0 ? (double)raw / reader.bytes : 0.0);
+
+    for (long run = 0; run < (runs > 0 ? runs : 1); run++)
+    {
+        summary = (struct summary){.first_ms = INT64_MAX, .last_ms = INT64_MIN};
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        if (fix_store_scan(&reader, ranges, range_count,
+                           FIX_STORE_COLUMN_BIT(FIX_STORE_TIME) |
+                               FIX_STORE_COLUMN_BIT(FIX_STORE_ACCURACY) |
+                               FIX_STORE_COLUMN_BIT(FIX_STORE_ALTITUDE) |
+                               FIX_STORE_COLUMN_BIT(FIX_STORE_SV_USED),
+                           summarize, &summary, &stats) != 0)
+        {
+            fprintf(stderr, "%s: damaged block\n", argv[1]);
+            fix_store_reader_close(&reader);
+            return 1;
+        }
+
+        double ms = elapsed_ms(&start);
+
+        best_ms = ms < best_ms ? ms : best_ms;
+    }
+
+    fprintf(stderr, "scan %.2f ms, %llu of %llu blocks skipped\n", best_ms,
+            (unsigned long long)stats.blocks_skipped, (unsigned long long)stats.blocks);
+
+    printf("fixes: %llu\n", (unsigned long long)summary.count);
+
+    if (summary.count > 0)
+    {
+        format_utc(summary.first_ms, from, sizeof(from));
+        format_utc(summary.last_ms, to, sizeof(to));
+        printf("from: %s\nto: %s\n", from, to);
+        printf("mean accuracy: %.2f m\n", summary.accuracy_dm / 10.0 / summary.count);
+        printf("mean altitude: %.2f m\n", summary.altitude_cm / 100.0 / summary.count);
+        printf("mean satellites used: %.2f\n", (double)summary.sv_used / summary.count);
+    }
+
+    fix_store_reader_close(&reader);
+    return 0;
+}
@@ -0,0 +1,1134 @@
+/*
+Name : fix_store.c
+
+Description :
+    This source file implements the host fix store: the block writer used by
+    the ingestion server and the mapped reader with the scan and filter
+    operators used by queries.
+
+    The writer stages rows column by column and encodes a block when
+    FIX_STORE_BLOCK_ROWS rows are staged or the store is closed. Every column
+    block is appended to its column file before the index entry, so an
+    interrupted store is valid up to its last index entry; the column data
+    after it is truncated when the store is opened again. Appends from several
+    threads are serialized by a mutex, so callers append staged rows in
+    blocks to take it rarely.
+
+    Group encodings keep the columns small: times and, within a device batch,
+    positions change little from row to row (delta), while devices, accuracy
+    and satellite counts stay in a narrow range (frame of reference).
+
+    Queries decode whole blocks into int64 arrays with branch-free loops and
+    filter them into a byte selection vector, so the compiler vectorizes them.
+    Blocks whose minimum and maximum exclude a range are not decoded at all,
+    and ranges that contain the whole block are not evaluated.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "fix_store.h"
+
+#define FILE_BUFFER_SIZE (256 * 1024)
+#define INDEX_NAME "blocks.idx"
+
+static const struct
+{
+    const char *name;
+    size_t width;
+} columns[FIX_STORE_COLUMNS] = {
+    [FIX_STORE_TIME] = {"time", sizeof(int64_t)},
+    [FIX_STORE_DEVICE] = {"device", sizeof(uint32_t)},
+    [FIX_STORE_LATITUDE] = {"latitude", sizeof(int32_t)},
+    [FIX_STORE_LONGITUDE] = {"longitude", sizeof(int32_t)},
+    [FIX_STORE_ALTITUDE] = {"altitude", sizeof(int32_t)},
+    [FIX_STORE_ACCURACY] = {"accuracy", sizeof(uint16_t)},
+    [FIX_STORE_SV_USED] = {"sv_used", sizeof(uint8_t)},
+};
+
+/* Copies one member of n rows into the staged column at the staged row. */
+#define STAGE(column, member)                                         \
+    for (size_t i = 0; i < n; i++)                                    \
+    {                                                                 \
+        store->staged[column][store->staged_rows + i] = r[i].member;  \
+    }
+
+/*
+Function : fix_store_column_name
+
+Description :
+    Returns the name of a column, which is also its file name without ".col".
+
+Parameter :
+    enum fix_store_column column - Column
+
+Return :
+    const char * - Column name
+
+Example Call :
+    printf("%s\n", fix_store_column_name(FIX_STORE_TIME));
+*/
+const char *fix_store_column_name(enum fix_store_column column)
+{
+    return columns[column].name;
+}
+
+/*
+Function : fix_store_column_width
+
+Description :
+    Returns the size of one uncompressed value of a column, e.g. to compare
+    the store size with a fixed-width layout.
+
+Parameter :
+    enum fix_store_column column - Column
+
+Return :
+    size_t - Value size in bytes
+
+Example Call :
+    uint64_t raw = rows * fix_store_column_width(FIX_STORE_TIME);
+*/
+size_t fix_store_column_width(enum fix_store_column column)
+{
+    return columns[column].width;
+}
+
+/*
+Function : bit_width
+
+Description :
+    Returns the number of bits needed to represent a value.
+
+Parameter :
+    uint64_t value - Value
+
+Return :
+    unsigned int - Bits, 0 for 0
+
+Example Call :
+    unsigned int width = bit_width(max - min);
+*/
+static unsigned int bit_width(uint64_t value)
+{
+    return value == 0 ? 0 : 64 - (unsigned int)__builtin_clzll(value);
+}
+
+/*
+Function : zigzag
+
+Description :
+    Maps a signed difference to an unsigned value that is small when the
+    difference is small in either direction (0, -1, 1, -2 ... to 0, 1, 2, 3 ...).
+
+Parameter :
+    int64_t value - Signed value
+
+Return :
+    uint64_t - Zigzag value
+
+Example Call :
+    uint64_t d = zigzag(value - prev);
+*/
+static uint64_t zigzag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/*
+Function : unzigzag
+
+Description :
+    Inverse of zigzag().
+
+Parameter :
+    uint64_t value - Zigzag value
+
+Return :
+    int64_t - Signed value
+
+Example Call :
+    int64_t d = unzigzag(packed[i]);
+*/
+static int64_t unzigzag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+/*
+Function : pack
+
+Description :
+    Bit-packs values of a given width, least significant bits first.
+
+Parameter :
+    uint8_t *out           - Output, (count * width + 7) / 8 bytes
+    const uint64_t *values - Values, each less than 2^width
+    uint32_t count         - Number of values
+    unsigned int width     - Bits per value, 0 to 64
+
+Return :
+    size_t - Bytes written
+
+Example Call :
+    size_t len = pack(out, packed, count, width);
+*/
+static size_t pack(uint8_t *out, const uint64_t *values, uint32_t count, unsigned int width)
+{
+    uint64_t acc = 0;
+    unsigned int fill = 0;
+    size_t len = 0;
+
+    if (width == 0)
+    {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint64_t v = values[i];
+
+        acc |= v << fill;
+        if (fill + width >= 64)
+        {
+            memcpy(out + len, &acc, sizeof(acc));
+            len += sizeof(acc);
+            acc = fill != 0 ? v >> (64 - fill) : 0;
+            fill = fill + width - 64;
+        }
+        else
+        {
+            fill += width;
+        }
+    }
+
+    for (unsigned int bit = 0; bit < fill; bit += 8)
+    {
+        out[len++] = (uint8_t)(acc >> bit);
+    }
+
+    return len;
+}
+
+/*
+Function : unpack
+
+Description :
+    Unpacks bit-packed values. Reads up to FIX_STORE_PADDING bytes past the
+    packed data.
+
+Parameter :
+    const uint8_t *in  - Packed values
+    uint64_t *values   - Output values
+    uint32_t count     - Number of values
+    unsigned int width - Bits per value, 0 to 64
+
+Return :
+    void
+
+Example Call :
+    unpack(in + FIX_STORE_GROUP_HEADER_SIZE, packed, count, width);
+*/
+static void unpack(const uint8_t *in, uint64_t *values, uint32_t count, unsigned int width)
+{
+    uint64_t mask = width == 64 ? UINT64_MAX : ((uint64_t)1 << width) - 1;
+
+    if (width == 0)
+    {
+        memset(values, 0, count * sizeof(*values));
+    }
+    else if (width <= 56)
+    {
+        /* A value and its bit offset always fit in one 8-byte load. */
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint64_t bit = (uint64_t)i * width;
+            uint64_t word;
+
+            memcpy(&word, in + (bit >> 3), sizeof(word));
+            values[i] = (word >> (bit & 7)) & mask;
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint64_t bit = (uint64_t)i * width;
+            unsigned int shift = (unsigned int)(bit & 7);
+            uint64_t lo, hi;
+
+            memcpy(&lo, in + (bit >> 3), sizeof(lo));
+            memcpy(&hi, in + (bit >> 3) + 8, sizeof(hi));
+            values[i] = ((lo >> shift) | (shift != 0 ? hi << (64 - shift) : 0)) & mask;
+        }
+    }
+}
+
+/*
+Function : encode_group
+
+Description :
+    Encodes up to FIX_STORE_GROUP values with the smaller of the frame of
+    reference and delta encodings.
+
+Parameter :
+    uint8_t *out          - Output
+    const int64_t *values - Values
+    uint32_t count        - Number of values, 1 to FIX_STORE_GROUP
+    int64_t prev          - Value before the group, the first value for the first group
+
+Return :
+    size_t - Bytes written
+
+Example Call :
+    len += encode_group(out + len, values + i, n, prev);
+*/
+static size_t encode_group(uint8_t *out, const int64_t *values, uint32_t count, int64_t prev)
+{
+    uint64_t packed[FIX_STORE_GROUP];
+    int64_t min = values[0];
+    int64_t max = values[0];
+    int64_t last = prev;
+    uint64_t deltas = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        min = values[i] < min ? values[i] : min;
+        max = values[i] > max ? values[i] : max;
+        deltas |= zigzag((int64_t)((uint64_t)values[i] - (uint64_t)last));
+        last = values[i];
+    }
+
+    unsigned int for_width = bit_width((uint64_t)max - (uint64_t)min);
+    unsigned int delta_width = bit_width(deltas);
+    int64_t base;
+
+    if (delta_width < for_width)
+    {
+        last = prev;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            packed[i] = zigzag((int64_t)((uint64_t)values[i] - (uint64_t)last));
+            last = values[i];
+        }
+        out[0] = FIX_STORE_GROUP_DELTA;
+        out[1] = (uint8_t)delta_width;
+        base = prev;
+    }
+    else
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            packed[i] = (uint64_t)values[i] - (uint64_t)min;
+        }
+        out[0] = FIX_STORE_GROUP_FOR;
+        out[1] = (uint8_t)for_width;
+        base = min;
+    }
+
+    memcpy(out + 2, &base, sizeof(base));
+    return FIX_STORE_GROUP_HEADER_SIZE + pack(out + FIX_STORE_GROUP_HEADER_SIZE, packed, count,
+                                              out[1]);
+}
+
+/*
+Function : encode_column
+
+Description :
+    Encodes a column block as groups followed by the padding.
+
+Parameter :
+    uint8_t *out          - Output, FIX_STORE_BLOCK_MAX_SIZE bytes
+    const int64_t *values - Values
+    uint32_t rows         - Number of values, 1 to FIX_STORE_BLOCK_ROWS
+
+Return :
+    size_t - Bytes written, with padding
+
+Example Call :
+    size_t size = encode_column(store->encoded, store->staged[c], rows);
+*/
+static size_t encode_column(uint8_t *out, const int64_t *values, uint32_t rows)
+{
+    size_t len = 0;
+    int64_t prev = values[0];
+
+    for (uint32_t i = 0; i < rows; i += FIX_STORE_GROUP)
+    {
+        uint32_t n = rows - i < FIX_STORE_GROUP ? rows - i : FIX_STORE_GROUP;
+
+        len += encode_group(out + len, values + i, n, prev);
+        prev = values[i + n - 1];
+    }
+
+    memset(out + len, 0, FIX_STORE_PADDING);
+    return len + FIX_STORE_PADDING;
+}
+
+/*
+Function : block_write
+
+Description :
+    Encodes the staged rows as a block, appends it to the column files and
+    commits it with its index entry.
+
+Parameter :
+    struct fix_store *store - Store, locked
+
+Return :
+    int - 0 on success, -1 on a write error
+
+Example Call :
+    if (store->staged_rows == FIX_STORE_BLOCK_ROWS) { ret = block_write(store); }
+*/
+static int block_write(struct fix_store *store)
+{
+    struct fix_store_block block = {.rows = store->staged_rows};
+    int ret = 0;
+
+    if (store->staged_rows == 0)
+    {
+        return 0;
+    }
+
+    for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+    {
+        const int64_t *values = store->staged[c];
+        struct fix_store_block_column *column = &block.columns[c];
+
+        column->min = values[0];
+        column->max = values[0];
+        for (uint32_t i = 1; i < block.rows; i++)
+        {
+            column->min = values[i] < column->min ? values[i] : column->min;
+            column->max = values[i] > column->max ? values[i] : column->max;
+        }
+
+        size_t size = encode_column(store->encoded, values, block.rows);
+
+        column->offset = store->ends[c];
+        column->size = (uint32_t)size;
+
+        if (fwrite(store->encoded, 1, size, store->files[c]) != size ||
+            fflush(store->files[c]) != 0)
+        {
+            ret = -1;
+        }
+
+        store->ends[c] += size;
+        store->bytes += size;
+    }
+
+    if (ret == 0 && (fwrite(&block, sizeof(block), 1, store->index) != 1 ||
+                     fflush(store->index) != 0))
+    {
+        ret = -1;
+    }
+
+    store->rows += block.rows;
+    store->blocks++;
+    store->staged_rows = 0;
+    return ret;
+}
+
+/*
+Function : index_load
+
+Description :
+    Opens or creates the index file, truncates an incomplete last entry and
+    loads the row count and column ends of the committed blocks.
+
+Parameter :
+    struct fix_store *store - Store
+    const char *dir         - Store directory
+
+Return :
+    int - 0 on success, -1 on error (errno is set)
+
+Example Call :
+    if (index_load(store, dir) != 0) { ... }
+*/
+static int index_load(struct fix_store *store, const char *dir)
+{
+    struct fix_store_file_header header;
+    struct fix_store_block block;
+    char path[4096];
+
+    snprintf(path, sizeof(path), "%s/%s", dir, INDEX_NAME);
+
+    store->index = fopen(path, "a+b");
+    if (store->index == NULL)
+    {
+        return -1;
+    }
+
+    if (fread(&header, sizeof(header), 1, store->index) != 1)
+    {
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, FIX_STORE_MAGIC, sizeof(header.magic));
+        header.version = FIX_STORE_VERSION;
+        header.columns = FIX_STORE_COLUMNS;
+        header.block_rows = FIX_STORE_BLOCK_ROWS;
+
+        if (ftruncate(fileno(store->index), 0) != 0 ||
+            fwrite(&header, sizeof(header), 1, store->index) != 1 ||
+            fflush(store->index) != 0)
+        {
+            return -1;
+        }
+        return 0;
+    }
+
+    if (memcmp(header.magic, FIX_STORE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != FIX_STORE_VERSION || header.columns != FIX_STORE_COLUMNS)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    while (fread(&block, sizeof(block), 1, store->index) == 1)
+    {
+        store->rows += block.rows;
+        store->blocks++;
+        for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+        {
+            store->ends[c] = block.columns[c].offset + block.columns[c].size;
+            store->bytes += block.columns[c].size;
+        }
+    }
+
+    off_t committed = (off_t)(sizeof(header) + store->blocks * sizeof(block));
+
+    fflush(store->index);
+    return ftruncate(fileno(store->index), committed);
+}
+
+/*
+Function : fix_store_open
+
+Description :
+    Opens a store for appending, creating its directory and files if they do
+    not exist. Column data after the last committed block (from an
+    interrupted writer) is removed.
+
+Parameter :
+    struct fix_store *store - Store
+    const char *dir         - Store directory
+
+Return :
+    int - 0 on success, -1 on error (errno is set, EINVAL for a damaged store)
+
+Example Call :
+    if (fix_store_open(&store, "fixes") != 0) { perror("fixes"); }
+*/
+int fix_store_open(struct fix_store *store, const char *dir)
+{
+    char path[4096];
+
+    memset(store, 0, sizeof(*store));
+    pthread_mutex_init(&store->lock, NULL);
+
+    if ((mkdir(dir, 0777) != 0 && errno != EEXIST) || index_load(store, dir) != 0)
+    {
+        fix_store_close(store);
+        return -1;
+    }
+
+    store->encoded = malloc(FIX_STORE_BLOCK_MAX_SIZE);
+    if (store->encoded == NULL)
+    {
+        fix_store_close(store);
+        return -1;
+    }
+
+    for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+    {
+        snprintf(path, sizeof(path), "%s/%s.col", dir, columns[c].name);
+
+        store->staged[c] = malloc(FIX_STORE_BLOCK_ROWS * sizeof(int64_t));
+        store->files[c] = fopen(path, "ab");
+        if (store->staged[c] == NULL || store->files[c] == NULL)
+        {
+            fix_store_close(store);
+            return -1;
+        }
+        setvbuf(store->files[c], NULL, _IOFBF, FILE_BUFFER_SIZE);
+
+        fseek(store->files[c], 0, SEEK_END);
+        if ((uint64_t)ftell(store->files[c]) < store->ends[c])
+        {
+            errno = EINVAL;
+            fix_store_close(store);
+            return -1;
+        }
+
+        if (ftruncate(fileno(store->files[c]), (off_t)store->ends[c]) != 0)
+        {
+            fix_store_close(store);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+Function : fix_store_append
+
+Description :
+    Appends rows, writing a block whenever FIX_STORE_BLOCK_ROWS rows are
+    staged. Safe to call from several threads.
+
+Parameter :
+    struct fix_store *store          - Store
+    const struct fix_store_row *rows - Rows
+    size_t count                     - Number of rows
+
+Return :
+    int - 0 on success, -1 on a write error
+
+Example Call :
+    fix_store_append(&store, staged, staged_count);
+*/
+int fix_store_append(struct fix_store *store, const struct fix_store_row *rows, size_t count)
+{
+    int ret = 0;
+
+    pthread_mutex_lock(&store->lock);
+
+    while (count > 0)
+    {
+        size_t room = FIX_STORE_BLOCK_ROWS - store->staged_rows;
+        size_t n = count < room ? count : room;
+        const struct fix_store_row *r = rows;
+
+        STAGE(FIX_STORE_TIME, time_ms);
+        STAGE(FIX_STORE_DEVICE, device_id);
+        STAGE(FIX_STORE_LATITUDE, latitude_e7);
+        STAGE(FIX_STORE_LONGITUDE, longitude_e7);
+        STAGE(FIX_STORE_ALTITUDE, altitude_cm);
+        STAGE(FIX_STORE_ACCURACY, accuracy_dm);
+        STAGE(FIX_STORE_SV_USED, sv_used);
+
+        store->staged_rows += (uint32_t)n;
+        rows += n;
+        count -= n;
+
+        if (store->staged_rows == FIX_STORE_BLOCK_ROWS && block_write(store) != 0)
+        {
+            ret = -1;
+        }
+    }
+
+    pthread_mutex_unlock(&store->lock);
+    return ret;
+}
+
+/*
+Function : fix_store_close
+
+Description :
+    Writes the staged rows as a last, shorter block and closes the files.
+    The row and block counts stay valid after closing.
+
+Parameter :
+    struct fix_store *store - Store
+
+Return :
+    int - 0 on success, -1 if the store could not be written
+
+Example Call :
+    fix_store_close(&store);
+*/
+int fix_store_close(struct fix_store *store)
+{
+    int ret = 0;
+
+    if (store->staged_rows > 0 && block_write(store) != 0)
+    {
+        ret = -1;
+    }
+
+    for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+    {
+        if (store->files[c] != NULL && fclose(store->files[c]) != 0)
+        {
+            ret = -1;
+        }
+        store->files[c] = NULL;
+        free(store->staged[c]);
+        store->staged[c] = NULL;
+    }
+
+    if (store->index != NULL && fclose(store->index) != 0)
+    {
+        ret = -1;
+    }
+    store->index = NULL;
+
+    free(store->encoded);
+    store->encoded = NULL;
+
+    pthread_mutex_destroy(&store->lock);
+    return ret;
+}
+
+/*
+Function : fix_store_row_from_fix
+
+Description :
+    Converts a decoded fix to a row at the resolution of the wire format, so
+    the conversion is exact for fixes decoded by fix_codec.
+
+Parameter :
+    struct fix_store_row *row       - Row output
+    uint32_t device_id              - Device the fix came from
+    const struct fix_codec_fix *fix - Fix
+
+Return :
+    void
+
+Example Call :
+    fix_store_row_from_fix(&rows[n++], batch.device_id, &batch.fixes[i]);
+*/
+void fix_store_row_from_fix(struct fix_store_row *row, uint32_t device_id,
+                            const struct fix_codec_fix *fix)
+{
+    row->time_ms = fix->timestamp_ms;
+    row->device_id = device_id;
+    row->latitude_e7 = (int32_t)lround(fix->latitude * 1e7);
+    row->longitude_e7 = (int32_t)lround(fix->longitude * 1e7);
+    row->altitude_cm = (int32_t)lround(fix->altitude * 100.0);
+    row->accuracy_dm = (uint16_t)lroundf(fix->accuracy * 10.0f);
+    row->sv_used = fix->sv_used;
+}
+
+/*
+Function : map_file
+
+Description :
+    Maps a file read-only. An empty file is not mapped.
+
+Parameter :
+    const char *path     - Path
+    const uint8_t **base - Mapping output, NULL for an empty file
+    size_t *size         - File size output
+
+Return :
+    int - 0 on success, -1 on failure
+
+Example Call :
+    if (map_file(path, &reader->columns[c], &reader->sizes[c]) != 0) { ... }
+*/
+static int map_file(const char *path, const uint8_t **base, size_t *size)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    *base = NULL;
+    *size = 0;
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    if (st.st_size > 0)
+    {
+        void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (p == MAP_FAILED)
+        {
+            close(fd);
+            return -1;
+        }
+        *base = p;
+        *size = (size_t)st.st_size;
+    }
+
+    close(fd);
+    return 0;
+}
+
+/*
+Function : fix_store_reader_open
+
+Description :
+    Maps a store for queries. Blocks committed after opening are not seen, so
+    a store can be queried while it is written.
+
+Parameter :
+    struct fix_store_reader *reader - Reader
+    const char *dir                 - Store directory
+
+Return :
+    int - 0 on success, -1 if the store cannot be read or is damaged
+
+Example Call :
+    if (fix_store_reader_open(&reader, "fixes") != 0) { ... }
+*/
+int fix_store_reader_open(struct fix_store_reader *reader, const char *dir)
+{
+    const struct fix_store_file_header *header;
+    char path[4096];
+
+    memset(reader, 0, sizeof(*reader));
+
+    snprintf(path, sizeof(path), "%s/%s", dir, INDEX_NAME);
+    if (map_file(path, &reader->index_base, &reader->index_size) != 0 ||
+        reader->index_size < sizeof(*header))
+    {
+        fix_store_reader_close(reader);
+        return -1;
+    }
+
+    header = (const struct fix_store_file_header *)reader->index_base;
+    if (memcmp(header->magic, FIX_STORE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != FIX_STORE_VERSION || header->columns != FIX_STORE_COLUMNS)
+    {
+        fix_store_reader_close(reader);
+        return -1;
+    }
+
+    for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+    {
+        snprintf(path, sizeof(path), "%s/%s.col", dir, columns[c].name);
+        if (map_file(path, &reader->columns[c], &reader->sizes[c]) != 0)
+        {
+            fix_store_reader_close(reader);
+            return -1;
+        }
+    }
+
+    reader->blocks = (const struct fix_store_block *)(reader->index_base + sizeof(*header));
+    reader->block_count = (reader->index_size - sizeof(*header)) / sizeof(struct fix_store_block);
+
+    for (uint64_t b = 0; b < reader->block_count; b++)
+    {
+        const struct fix_store_block *block = &reader->blocks[b];
+
+        if (block->rows == 0 || block->rows > FIX_STORE_BLOCK_ROWS)
+        {
+            fix_store_reader_close(reader);
+            return -1;
+        }
+
+        for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+        {
+            const struct fix_store_block_column *column = &block->columns[c];
+
+            if (column->size < FIX_STORE_PADDING || column->offset > reader->sizes[c] ||
+                column->size > reader->sizes[c] - column->offset)
+            {
+                fix_store_reader_close(reader);
+                return -1;
+            }
+            reader->bytes += column->size;
+        }
+
+        reader->rows += block->rows;
+    }
+
+    return 0;
+}
+
+/*
+Function : fix_store_reader_close
+
+Description :
+    Unmaps a store.
+
+Parameter :
+    struct fix_store_reader *reader - Reader
+
+Return :
+    void
+
+Example Call :
+    fix_store_reader_close(&reader);
+*/
+void fix_store_reader_close(struct fix_store_reader *reader)
+{
+    for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+    {
+        if (reader->columns[c] != NULL)
+        {
+            munmap((void *)reader->columns[c], reader->sizes[c]);
+        }
+    }
+
+    if (reader->index_base != NULL)
+    {
+        munmap((void *)reader->index_base, reader->index_size);
+    }
+
+    memset(reader, 0, sizeof(*reader));
+}
+
+/*
+Function : fix_store_decode
+
+Description :
+    Decodes one column of a block.
+
+Parameter :
+    const struct fix_store_reader *reader - Reader
+    uint64_t block                        - Block number
+    enum fix_store_column column          - Column
+    int64_t *values                       - Output, FIX_STORE_BLOCK_ROWS values
+
+Return :
+    int - 0 on success, -1 if the block is damaged
+
+Example Call :
+    fix_store_decode(&reader, b, FIX_STORE_TIME, times);
+*/
+int fix_store_decode(const struct fix_store_reader *reader, uint64_t block,
+                     enum fix_store_column column, int64_t *values)
+{
+    const struct fix_store_block *b = &reader->blocks[block];
+    const uint8_t *in = reader->columns[column] + b->columns[column].offset;
+    const uint8_t *end = in + b->columns[column].size - FIX_STORE_PADDING;
+    uint64_t packed[FIX_STORE_GROUP];
+
+    for (uint32_t i = 0; i < b->rows; i += FIX_STORE_GROUP)
+    {
+        uint32_t n = b->rows - i < FIX_STORE_GROUP ? b->rows - i : FIX_STORE_GROUP;
+        int64_t base;
+
+        if (end - in < FIX_STORE_GROUP_HEADER_SIZE || in[0] > FIX_STORE_GROUP_DELTA ||
+            in[1] > 64)
+        {
+            return -1;
+        }
+
+        unsigned int width = in[1];
+        size_t len = FIX_STORE_GROUP_HEADER_SIZE + ((size_t)n * width + 7) / 8;
+
+        if ((size_t)(end - in) < len)
+        {
+            return -1;
+        }
+
+        memcpy(&base, in + 2, sizeof(base));
+        unpack(in + FIX_STORE_GROUP_HEADER_SIZE, packed, n, width);
+
+        if (in[0] == FIX_STORE_GROUP_FOR)
+        {
+            for (uint32_t k = 0; k < n; k++)
+            {
+                values[i + k] = (int64_t)((uint64_t)base + packed[k]);
+            }
+        }
+        else
+        {
+            uint64_t v = (uint64_t)base;
+
+            for (uint32_t k = 0; k < n; k++)
+            {
+                v += (uint64_t)unzigzag(packed[k]);
+                values[i + k] = (int64_t)v;
+            }
+        }
+
+        in += len;
+    }
+
+    return 0;
+}
+
+/*
+Function : fix_store_filter_range
+
+Description :
+    Clears the selection of values outside an inclusive range. Branch-free,
+    so it compiles to vector compares.
+
+Parameter :
+    const int64_t *values - Column values
+    uint32_t count        - Number of values
+    int64_t min           - Smallest selected value
+    int64_t max           - Largest selected value
+    uint8_t *selection    - Selection vector, 1 for selected rows, updated
+
+Return :
+    uint32_t - Number of rows still selected
+
+Example Call :
+    selected = fix_store_filter_range(values, rows, from, to, selection);
+*/
+uint32_t fix_store_filter_range(const int64_t *values, uint32_t count, int64_t min, int64_t max,
+                                uint8_t *selection)
+{
+    uint32_t selected = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t s = selection[i] & (uint8_t)(values[i] >= min) & (uint8_t)(values[i] <= max);
+
+        selection[i] = s;
+        selected += s;
+    }
+
+    return selected;
+}
+
+/*
+Function : fix_store_scan
+
+Description :
+    Scans the store for rows inside all ranges and calls a callback for every
+    block with selected rows, with the requested columns decoded. Blocks are
+    skipped by their minimum and maximum where possible; filter columns are
+    decoded only when a range does not contain the whole block.
+
+Parameter :
+    const struct fix_store_reader *reader - Reader
+    const struct fix_store_range *ranges  - Ranges, all must match
+    size_t range_count                    - Number of ranges, 0 selects all rows
+    uint32_t columns                      - Columns to decode, FIX_STORE_COLUMN_BIT() mask
+    fix_store_scan_cb cb                  - Callback
+    void *ctx                             - Callback context
+    struct fix_store_scan_stats *stats    - Statistics output, may be NULL
+
+Return :
+    int - 0 on success, -1 on an invalid range, a damaged block or no memory
+
+Example Call :
+    fix_store_scan(&reader, ranges, 2, FIX_STORE_COLUMN_BIT(FIX_STORE_ACCURACY),
+                   accumulate, &sum, &stats);
+*/
+int fix_store_scan(const struct fix_store_reader *reader, const struct fix_store_range *ranges,
+                   size_t range_count, uint32_t columns, fix_store_scan_cb cb, void *ctx,
+                   struct fix_store_scan_stats *stats)
+{
+    struct fix_store_scan_stats s = {0};
+    int64_t *buffer = malloc((size_t)FIX_STORE_COLUMNS * FIX_STORE_BLOCK_ROWS * sizeof(int64_t));
+    uint8_t *selection = malloc(FIX_STORE_BLOCK_ROWS);
+    int ret = 0;
+
+    for (size_t r = 0; r < range_count; r++)
+    {
+        if ((unsigned int)ranges[r].column >= FIX_STORE_COLUMNS)
+        {
+            ret = -1;
+        }
+    }
+
+    if (buffer == NULL || selection == NULL)
+    {
+        ret = -1;
+    }
+
+    for (uint64_t b = 0; ret == 0 && b < reader->block_count; b++)
+    {
+        const struct fix_store_block *block = &reader->blocks[b];
+        struct fix_store_vector vector = {.rows = block->rows, .selection = selection};
+        uint32_t decoded = 0;
+        bool skip = false;
+
+        s.blocks++;
+
+        for (size_t r = 0; r < range_count; r++)
+        {
+            const struct fix_store_block_column *column = &block->columns[ranges[r].column];
+
+            skip |= column->max < ranges[r].min || column->min > ranges[r].max;
+        }
+
+        if (skip)
+        {
+            s.blocks_skipped++;
+            continue;
+        }
+
+        memset(selection, 1, block->rows);
+        vector.selected = block->rows;
+
+        for (size_t r = 0; r < range_count && vector.selected > 0; r++)
+        {
+            enum fix_store_column c = ranges[r].column;
+            const struct fix_store_block_column *column = &block->columns[c];
+            int64_t *values = buffer + (size_t)c * FIX_STORE_BLOCK_ROWS;
+
+            if (column->min >= ranges[r].min && column->max <= ranges[r].max)
+            {
+                continue;
+            }
+
+            if (!(decoded & FIX_STORE_COLUMN_BIT(c)))
+            {
+                if (fix_store_decode(reader, b, c, values) != 0)
+                {
+                    ret = -1;
+                    break;
+                }
+                decoded |= FIX_STORE_COLUMN_BIT(c);
+            }
+
+            vector.selected = fix_store_filter_range(values, block->rows, ranges[r].min,
+                                                     ranges[r].max, selection);
+        }
+
+        if (ret != 0 || vector.selected == 0)
+        {
+            continue;
+        }
+
+        for (int c = 0; c < FIX_STORE_COLUMNS; c++)
+        {
+            int64_t *values = buffer + (size_t)c * FIX_STORE_BLOCK_ROWS;
+
+            if (!(columns & FIX_STORE_COLUMN_BIT(c)))
+            {
+                continue;
+            }
+
+            if (!(decoded & FIX_STORE_COLUMN_BIT(c)))
+            {
+                if (fix_store_decode(reader, b, (enum fix_store_column)c, values) != 0)
+                {
+                    ret = -1;
+                    break;
+                }
+                decoded |= FIX_STORE_COLUMN_BIT(c);
+            }
+
+            vector.values[c] = values;
+        }
+
+        if (ret == 0)
+        {
+            s.rows_selected += vector.selected;
+            cb(&vector, ctx);
+        }
+    }
+
+    free(buffer);
+    free(selection);
+
+    if (stats != NULL)
+    {
+        *stats = s;
+    }
+
+    return ret;
+}
@@ -0,0 +1,194 @@
+/*
+Name : fix_store.h
+
+Description :
+    Header file for the host fix store. Declares an append-only columnar store
+    of decoded fixes: one file per column in a directory, holding the column
+    in blocks of up to FIX_STORE_BLOCK_ROWS values that are compressed
+    independently, and an index file ("blocks.idx") with one entry per block.
+
+        blocks.idx : fix_store_file_header, fix_store_block ...
+        <column>.col : compressed column blocks, in index order
+
+    An index entry records where every column of the block is and the
+    smallest and largest value of each column, so scans skip blocks that
+    cannot match a filter without reading them. A block is committed by its
+    index entry, written after its column data. All values are little-endian.
+
+    A column block is a sequence of groups of FIX_STORE_GROUP values, each
+    packed with the smaller of two encodings:
+
+        frame of reference : values minus the group minimum
+        delta              : zigzag differences from the previous value
+
+    as a mode byte, a bit width byte, an int64 base (the minimum or the value
+    before the group) and the values bit-packed at that width. Column blocks
+    are followed by FIX_STORE_PADDING zero bytes so decoders can use 8-byte
+    loads.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _FIX_STORE_H
+#define _FIX_STORE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "fix_codec.h"
+
+#define FIX_STORE_MAGIC "FIXSTOR"
+#define FIX_STORE_VERSION 1
+
+#define FIX_STORE_BLOCK_ROWS 16384
+#define FIX_STORE_GROUP 128
+#define FIX_STORE_GROUP_HEADER_SIZE 10
+#define FIX_STORE_PADDING 16
+
+/* Largest encoded column block: every group at 64 bits per value. */
+#define FIX_STORE_BLOCK_MAX_SIZE                                               \
+    ((FIX_STORE_BLOCK_ROWS / FIX_STORE_GROUP) * FIX_STORE_GROUP_HEADER_SIZE +  \
+     FIX_STORE_BLOCK_ROWS * sizeof(int64_t) + FIX_STORE_PADDING)
+
+enum fix_store_column
+{
+    FIX_STORE_TIME,      /* Unix ms */
+    FIX_STORE_DEVICE,    /* Device ID */
+    FIX_STORE_LATITUDE,  /* 1e-7 degrees */
+    FIX_STORE_LONGITUDE, /* 1e-7 degrees */
+    FIX_STORE_ALTITUDE,  /* cm */
+    FIX_STORE_ACCURACY,  /* dm */
+    FIX_STORE_SV_USED,   /* Satellites used */
+    FIX_STORE_COLUMNS,
+};
+
+#define FIX_STORE_COLUMN_BIT(column) (1u << (column))
+#define FIX_STORE_ALL_COLUMNS ((1u << FIX_STORE_COLUMNS) - 1)
+
+enum fix_store_group_mode
+{
+    FIX_STORE_GROUP_FOR = 0,
+    FIX_STORE_GROUP_DELTA = 1,
+};
+
+struct fix_store_row
+{
+    int64_t time_ms;
+    uint32_t device_id;
+    int32_t latitude_e7;
+    int32_t longitude_e7;
+    int32_t altitude_cm;
+    uint16_t accuracy_dm;
+    uint8_t sv_used;
+};
+
+struct fix_store_file_header
+{
+    char magic[8];
+    uint16_t version;
+    uint16_t columns;
+    uint32_t block_rows;
+};
+
+struct fix_store_block_column
+{
+    uint64_t offset; /* In the column file */
+    uint32_t size;   /* Encoded bytes, with padding */
+    uint32_t reserved;
+    int64_t min;
+    int64_t max;
+};
+
+struct fix_store_block
+{
+    uint32_t rows;
+    uint32_t reserved;
+    struct fix_store_block_column columns[FIX_STORE_COLUMNS];
+};
+
+/* Writer. Rows are staged in a block and appended when it is full or closed. */
+struct fix_store
+{
+    FILE *files[FIX_STORE_COLUMNS];
+    FILE *index;
+    pthread_mutex_t lock;
+    uint64_t rows;
+    uint64_t blocks;
+    uint64_t bytes; /* Column data, all blocks */
+    uint64_t ends[FIX_STORE_COLUMNS];
+
+    int64_t *staged[FIX_STORE_COLUMNS];
+    uint32_t staged_rows;
+    uint8_t *encoded;
+};
+
+/* Mapped store for queries. */
+struct fix_store_reader
+{
+    const uint8_t *columns[FIX_STORE_COLUMNS];
+    size_t sizes[FIX_STORE_COLUMNS];
+    const uint8_t *index_base;
+    size_t index_size;
+    const struct fix_store_block *blocks;
+    uint64_t block_count;
+    uint64_t rows;
+    uint64_t bytes;
+};
+
+/* Inclusive value range of a column; scans select the rows inside all ranges. */
+struct fix_store_range
+{
+    enum fix_store_column column;
+    int64_t min;
+    int64_t max;
+};
+
+/* Decoded block passed to scan callbacks. */
+struct fix_store_vector
+{
+    uint32_t rows;
+    uint32_t selected;
+    const uint8_t *selection;                 /* 1 for selected rows, 0 otherwise */
+    const int64_t *values[FIX_STORE_COLUMNS]; /* Requested columns, NULL otherwise */
+};
+
+struct fix_store_scan_stats
+{
+    uint64_t blocks;
+    uint64_t blocks_skipped; /* By the block minimum and maximum */
+    uint64_t rows_selected;
+};
+
+typedef void (*fix_store_scan_cb)(const struct fix_store_vector *vector, void *ctx);
+
+int fix_store_open(struct fix_store *store, const char *dir);
+
+int fix_store_append(struct fix_store *store, const struct fix_store_row *rows, size_t count);
+
+int fix_store_close(struct fix_store *store);
+
+void fix_store_row_from_fix(struct fix_store_row *row, uint32_t device_id,
+                            const struct fix_codec_fix *fix);
+
+const char *fix_store_column_name(enum fix_store_column column);
+
+size_t fix_store_column_width(enum fix_store_column column);
+
+int fix_store_reader_open(struct fix_store_reader *reader, const char *dir);
+
+void fix_store_reader_close(struct fix_store_reader *reader);
+
+int fix_store_decode(const struct fix_store_reader *reader, uint64_t block,
+                     enum fix_store_column column, int64_t *values);
+
+uint32_t fix_store_filter_range(const int64_t *values, uint32_t count, int64_t min, int64_t max,
+                                uint8_t *selection);
+
+int fix_store_scan(const struct fix_store_reader *reader, const struct fix_store_range *ranges,
+                   size_t range_count, uint32_t columns, fix_store_scan_cb cb, void *ctx,
+                   struct fix_store_scan_stats *stats);
+
+#endif
@@ -0,0 +1,154 @@
+/*
+Name : geodesy_bench.c
+
+Description :
+    Host benchmark and accuracy table for the distance functions in
+    components/geodesy. Compares haversine (spherical), flat earth
+    (equirectangular) and Vincenty (WGS-84) over a range of distances and
+    latitudes, with Vincenty as the reference, and measures time per call and
+    Vincenty iterations with and without the warm start from the previous fix.
+
+    Build and run:
+        cc -O2 -I../../components/fast_trig -I../../components/geodesy \
+            geodesy_bench.c ../../components/geodesy/geodesy.c \
+            ../../components/geodesy/geodesy_ellipsoid.c \
+            ../../components/fast_trig/fast_trig.c -lm -o geodesy_bench
+        ./geodesy_bench
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+#include "fast_trig.h"
+#include "geodesy.h"
+
+#define TRACK_POINTS 100000
+#define ROUNDS 20
+
+struct pair
+{
+    const char *label;
+    double lat1, lon1, lat2, lon2;
+};
+
+static const struct pair pairs[] = {
+    {"10 m, 61N E-W", 61.4937533, 23.7758897, 61.4937533, 23.7760779},
+    {"100 m, 61N N-S", 61.4937533, 23.7758897, 61.4946513, 23.7758897},
+    {"1 km, 61N NE", 61.4937533, 23.7758897, 61.5001000, 23.7893000},
+    {"10 km, equator", 0.0, 10.0, 0.0, 10.0898315},
+    {"10 km, 45N N-S", 45.0, 10.0, 45.0899, 10.0},
+    {"100 km, 61N", 61.4937533, 23.7758897, 60.6000000, 23.7758897},
+    {"1000 km, 30N", 30.0, 0.0, 35.0, 8.0},
+    {"10000 km", 60.0, 24.0, -33.9, 18.4},
+};
+
+static volatile double sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static double track_lat[TRACK_POINTS];
+static double track_lon[TRACK_POINTS];
+
+int main(void)
+{
+    printf("Accuracy vs Vincenty (WGS-84)\n");
+    printf("%-16s %14s %12s %8s %12s %8s %5s\n", "case", "vincenty [m]",
+           "haversine", "[%]", "flat", "[%]", "iter");
+
+    for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); i++)
+    {
+        const struct pair *p = &pairs[i];
+        struct geo_wgs84_origin origin;
+        double ref;
+
+        geo_wgs84_origin_set(&origin, p->lat1, p->lon1);
+        int iterations = geo_wgs84_distance(&origin, p->lat2, p->lon2, &ref);
+
+        double hav = geo_distance(p->lat1, p->lon1, p->lat2, p->lon2);
+        double flat = geo_flat_distance(p->lat1, p->lon1, p->lat2, p->lon2);
+
+        printf("%-16s %14.3f %+12.3f %+8.3f %+12.3f %+8.3f %5d\n", p->label, ref,
+               hav - ref, 100.0 * (hav - ref) / ref,
+               flat - ref, 100.0 * (flat - ref) / ref, iterations);
+    }
+
+    /* Walking track at 1 Hz, ~1.4 m/s heading north-east from the origin. */
+    for (int i = 0; i < TRACK_POINTS; i++)
+    {
+        track_lat[i] = 61.4937533 + i * 9e-6;
+        track_lon[i] = 23.7758897 + i * 1.9e-5;
+    }
+
+    struct geo_origin origin;
+    struct geo_wgs84_origin wgs84;
+    long cold_iterations = 0;
+    long warm_iterations = 0;
+    double d;
+
+    geo_origin_set(&origin, track_lat[0], track_lon[0]);
+    geo_wgs84_origin_set(&wgs84, track_lat[0], track_lon[0]);
+
+    printf("\nTime per call over a %d point track\n", TRACK_POINTS);
+
+    double start = now_ns();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < TRACK_POINTS; i++)
+        {
+            struct geo_nav nav;
+
+            geo_nav_get(&origin, track_lat[i], track_lon[i], &nav);
+            sink = nav.distance_m;
+        }
+    }
+    printf("  haversine + bearing  %7.2f ns\n", (now_ns() - start) / (ROUNDS * TRACK_POINTS));
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < TRACK_POINTS; i++)
+        {
+            sink = geo_flat_distance(track_lat[0], track_lon[0], track_lat[i], track_lon[i]);
+        }
+    }
+    printf("  flat earth           %7.2f ns\n", (now_ns() - start) / (ROUNDS * TRACK_POINTS));
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < TRACK_POINTS; i++)
+        {
+            wgs84.lambda_offset = 0.0;
+            cold_iterations += geo_wgs84_distance(&wgs84, track_lat[i], track_lon[i], &d);
+            sink = d;
+        }
+    }
+    printf("  vincenty, cold start %7.2f ns, %.2f iterations\n",
+           (now_ns() - start) / (ROUNDS * TRACK_POINTS),
+           (double)cold_iterations / (ROUNDS * TRACK_POINTS));
+
+    start = now_ns();
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        for (int i = 0; i < TRACK_POINTS; i++)
+        {
+            warm_iterations += geo_wgs84_distance(&wgs84, track_lat[i], track_lon[i], &d);
+            sink = d;
+        }
+    }
+    printf("  vincenty, warm start %7.2f ns, %.2f iterations\n",
+           (now_ns() - start) / (ROUNDS * TRACK_POINTS),
+           (double)warm_iterations / (ROUNDS * TRACK_POINTS));
+
+    return 0;
+}
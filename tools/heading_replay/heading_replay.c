@@ -0,0 +1,235 @@
+/*
+Name : heading_replay.c
+
+Description :
+    Host replay harness for components/heading. Simulates a device that stands,
+    walks and cycles with turns, with GNSS position errors (slowly wandering
+    and white, reported accuracy) and PVT velocity noise, from which the PVT
+    speed, heading and heading accuracy are derived as the modem does. Compares
+    the PVT heading with the estimator on heading error while moving and on
+    heading change events: a consumer reports an event when the heading moves
+    more than EVENT_THRESHOLD degrees from the last reported one, optionally
+    only while the heading accuracy is below EVENT_MAX_ACCURACY. Events that
+    the true heading does not make are spurious.
+
+    Build and run:
+        cc -O2 -I../../components/heading heading_replay.c \
+            ../../components/heading/heading.c -lm -o heading_replay
+        ./heading_replay
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "heading.h"
+
+#define DURATION_S (4 * 3600)
+#define ORIGIN_LAT 60.1695
+#define ORIGIN_LON 24.9354
+#define METERS_PER_DEG_LAT 111195.0
+
+#define WALK_SPEED 1.4  /* m/s */
+#define CYCLE_SPEED 5.0 /* m/s */
+
+/* GNSS position error: first order Gauss-Markov plus white noise, per axis. */
+#define POS_WANDER_M 3.0
+#define POS_WANDER_TAU_S 60.0
+#define POS_WHITE_M 0.7
+#define POS_ACCURACY_M 4.0f
+
+/* PVT velocity noise per axis. */
+#define VEL_NOISE 0.5
+
+#define FAST_SPEED 2.0f
+
+#define EVENT_THRESHOLD 45.0
+#define EVENT_MAX_ACCURACY 30.0f
+
+/* Epochs where the true speed is above this count as moving. */
+#define MOVING_SPEED 0.5
+
+enum activity
+{
+    STAND,
+    WALK,
+    CYCLE,
+};
+
+struct result
+{
+    double err_sq;
+    int within_30;
+    int moving;
+    double walk_sq;
+    int walking;
+    bool reported;
+    double last_event;
+    int events;
+    int spurious;
+};
+
+static double gaussian(void)
+{
+    double u1 = (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+    double u2 = (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static double wrap180(double angle)
+{
+    angle = fmod(angle + 180.0, 360.0);
+    if (angle < 0.0)
+    {
+        angle += 360.0;
+    }
+    return angle - 180.0;
+}
+
+static bool event_update(struct result *r, double heading, float accuracy)
+{
+    if (isnan(heading) || accuracy >= EVENT_MAX_ACCURACY)
+    {
+        return false;
+    }
+
+    if (!r->reported || fabs(wrap180(heading - r->last_event)) > EVENT_THRESHOLD)
+    {
+        bool event = r->reported;
+
+        r->reported = true;
+        r->last_event = heading;
+        return event;
+    }
+
+    return false;
+}
+
+static void score(struct result *r, double heading, float accuracy, double true_heading,
+                  double true_speed, bool true_event)
+{
+    if (true_speed > MOVING_SPEED && !isnan(heading))
+    {
+        double err = wrap180(heading - true_heading);
+
+        r->err_sq += err * err;
+        r->within_30 += fabs(err) < 30.0;
+        r->moving++;
+
+        if (true_speed < FAST_SPEED)
+        {
+            r->walk_sq += err * err;
+            r->walking++;
+        }
+    }
+
+    if (event_update(r, heading, accuracy))
+    {
+        r->events++;
+        r->spurious += !true_event;
+    }
+}
+
+static void print(const char *name, const struct result *r)
+{
+    double hours = DURATION_S / 3600.0;
+
+    printf("%-22s %12.1f %12.1f %11.1f %10.1f %12.1f\n", name, sqrt(r->err_sq / r->moving),
+           sqrt(r->walk_sq / r->walking), 100.0 * r->within_30 / r->moving,
+           r->events / hours, r->spurious / hours);
+}
+
+int main(void)
+{
+    struct heading_estimator est;
+    struct result raw = {0}, gated = {0}, filtered = {0}, truth = {0};
+    enum activity activity = STAND;
+    int remaining = 0;
+    int leg = 0;
+    double east = 0.0, north = 0.0;
+    double true_heading = 0.0, speed = 0.0;
+    double wander_e = 0.0, wander_n = 0.0;
+    int last_true_event = -1000;
+
+    srand(1);
+    heading_init(&est, FAST_SPEED);
+
+    for (int t = 0; t < DURATION_S; t++)
+    {
+        /* Stand for 1 to 5 minutes, walk for 5 or cycle for 10, in legs with turns. */
+        if (--remaining <= 0)
+        {
+            int r = rand() % 4;
+
+            activity = r == 0 ? CYCLE : (r == 1 ? STAND : WALK);
+            remaining = activity == STAND ? 60 + rand() % 240 : (activity == WALK ? 300 : 600);
+            speed = activity == STAND ? 0.0 : (activity == WALK ? WALK_SPEED : CYCLE_SPEED);
+            leg = 0;
+        }
+
+        if (activity != STAND && --leg <= 0)
+        {
+            true_heading = fmod(true_heading + (rand() % 2 ? 90.0 : -90.0) + 360.0, 360.0);
+            leg = 20 + rand() % 70;
+        }
+
+        double ve = speed * sin(true_heading * M_PI / 180.0);
+        double vn = speed * cos(true_heading * M_PI / 180.0);
+
+        east += ve;
+        north += vn;
+
+        double phi = exp(-1.0 / POS_WANDER_TAU_S);
+        double drive = sqrt(1.0 - phi * phi) * POS_WANDER_M;
+
+        wander_e = phi * wander_e + drive * gaussian();
+        wander_n = phi * wander_n + drive * gaussian();
+
+        double lat = ORIGIN_LAT + (north + wander_n + POS_WHITE_M * gaussian()) /
+                                      METERS_PER_DEG_LAT;
+        double lon = ORIGIN_LON + (east + wander_e + POS_WHITE_M * gaussian()) /
+                                      (METERS_PER_DEG_LAT * cos(ORIGIN_LAT * M_PI / 180.0));
+
+        /* PVT speed and heading from the measured velocity. */
+        double me = ve + VEL_NOISE * gaussian();
+        double mn = vn + VEL_NOISE * gaussian();
+        float pvt_speed = (float)sqrt(me * me + mn * mn);
+        float pvt_heading = (float)fmod(atan2(me, mn) * 180.0 / M_PI + 360.0, 360.0);
+        float pvt_accuracy =
+            (float)fmin(180.0, atan2(VEL_NOISE, pvt_speed) * 180.0 / M_PI);
+        int64_t now = (int64_t)t * 1000;
+
+        heading_update(&est, now, lat, lon, POS_ACCURACY_M, pvt_speed, pvt_heading,
+                       pvt_accuracy);
+
+        /* True events, and the window in which an estimator may follow one. */
+        if (speed > 0.0 && event_update(&truth, true_heading, 0.0f))
+        {
+            truth.events++;
+            last_true_event = t;
+        }
+
+        bool true_event = t - last_true_event < 60;
+
+        score(&raw, pvt_heading, 0.0f, true_heading, speed, true_event);
+        score(&gated, pvt_heading, pvt_accuracy, true_heading, speed, true_event);
+        score(&filtered, heading_get(&est), heading_accuracy_get(&est), true_heading, speed,
+              true_event);
+    }
+
+    printf("%d h at 1 Hz, walking %.1f m/s and cycling %.1f m/s with 90 deg turns, "
+           "%.1f true events/h\n\n",
+           DURATION_S / 3600, WALK_SPEED, CYCLE_SPEED, truth.events / (DURATION_S / 3600.0));
+    printf("%-22s %12s %12s %11s %10s %12s\n", "heading", "RMS err deg", "RMS walk deg",
+           "within 30%", "events/h", "spurious/h");
+    print("PVT", &raw);
+    print("PVT, accuracy gated", &gated);
+    print("estimator", &filtered);
+
+    return 0;
+}
@@ -0,0 +1,456 @@
+/*
+Name : ingest_server.c
+
+Description :
+    Receives fix batches (components/fix_codec) uplinked by a fleet of devices
+    over UDP and appends them to a columnar fix store (tools/fix_store).
+
+    Every receiver thread has its own socket bound to the same port with
+    SO_REUSEPORT, so the kernel spreads datagrams over the threads by source
+    address and port without a shared socket lock. A thread reads up to
+    RECV_BATCH datagrams per recvmmsg() call, decodes them and stages the
+    fixes, taking the store lock only once per STAGE_ROWS fixes. Datagrams
+    that are not valid batches are counted and dropped.
+
+    With -s the server load tests itself: sender threads each simulate
+    SENDER_BATCHES moving devices and send their batches from distinct
+    sockets (so the load spreads like a fleet) to the loopback address with
+    sendmmsg() as fast as they can, and the received and
+    stored rate is reported in batches/s. UDP may drop datagrams under
+    overload, so sent and received counts are both printed.
+
+    Linux only (SO_REUSEPORT distribution, recvmmsg, sendmmsg).
+
+    Build and run:
+        cc -O2 -pthread -I../fix_store -I../../components/fix_codec ingest_server.c \
+            ../fix_store/fix_store.c ../../components/fix_codec/fix_codec.c -lm -o ingest_server
+        ./ingest_server <store dir> [-p port] [-r receivers] [-s senders] [-d seconds]
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "fix_codec.h"
+#include "fix_store.h"
+
+#define DEFAULT_PORT 5684
+#define DEFAULT_RECEIVERS 4
+#define MAX_THREADS 64
+
+#define RECV_BATCH 64
+#define STAGE_ROWS 4096
+#define SOCKET_BUFFER_SIZE (8 * 1024 * 1024)
+#define RECV_TIMEOUT_MS 100
+
+/* Synthetic load: devices (one batch each per round) per sender, fixes per batch. */
+#define SENDER_BATCHES 256
+#define SENDER_FIXES 16
+#define SENDER_START_MS 1790000000000LL
+
+struct receiver
+{
+    pthread_t thread;
+    int fd;
+    struct fix_store *store;
+    uint64_t batches;
+    uint64_t fixes;
+    uint64_t errors;
+};
+
+struct sender
+{
+    pthread_t thread;
+    int index;
+    uint16_t port;
+    uint64_t batches;
+};
+
+static atomic_bool receivers_stop;
+static atomic_bool senders_stop;
+
+static void handle_signal(int sig)
+{
+    (void)sig;
+    atomic_store(&senders_stop, true);
+    atomic_store(&receivers_stop, true);
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int open_socket(uint16_t port, int reuse_port)
+{
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(reuse_port ? INADDR_ANY : INADDR_LOOPBACK),
+    };
+    struct timeval timeout = {.tv_usec = RECV_TIMEOUT_MS * 1000};
+    int size = SOCKET_BUFFER_SIZE;
+    int one = 1;
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    setsockopt(fd, SOL_SOCKET, reuse_port ? SO_RCVBUF : SO_SNDBUF, &size, sizeof(size));
+
+    if (reuse_port)
+    {
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) != 0)
+        {
+            close(fd);
+            return -1;
+        }
+    }
+    else
+    {
+        /* Senders bind to an ephemeral port so each is a distinct flow. */
+        addr.sin_port = 0;
+    }
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+static void flush(struct receiver *r, struct fix_store_row *rows, size_t *count)
+{
+    if (*count > 0 && fix_store_append(r->store, rows, *count) != 0)
+    {
+        perror("fix store");
+    }
+    *count = 0;
+}
+
+static void *receive(void *arg)
+{
+    static _Thread_local uint8_t buffers[RECV_BATCH][FIX_CODEC_MAX_SIZE];
+    static _Thread_local struct fix_store_row rows[STAGE_ROWS];
+    struct receiver *r = arg;
+    struct mmsghdr msgs[RECV_BATCH];
+    struct iovec iovs[RECV_BATCH];
+    struct fix_codec_batch batch;
+    size_t staged = 0;
+
+    for (int i = 0; i < RECV_BATCH; i++)
+    {
+        iovs[i] = (struct iovec){.iov_base = buffers[i], .iov_len = sizeof(buffers[i])};
+        msgs[i] = (struct mmsghdr){.msg_hdr = {.msg_iov = &iovs[i], .msg_iovlen = 1}};
+    }
+
+    while (!atomic_load(&receivers_stop))
+    {
+        int n = recvmmsg(r->fd, msgs, RECV_BATCH, MSG_WAITFORONE, NULL);
+
+        if (n < 0)
+        {
+            /* Timeout: flush so an idle server does not hold fixes back. */
+            flush(r, rows, &staged);
+            continue;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            if ((msgs[i].msg_hdr.msg_flags & MSG_TRUNC) ||
+                fix_codec_decode(buffers[i], msgs[i].msg_len, &batch) != 0)
+            {
+                r->errors++;
+                continue;
+            }
+
+            if (staged + batch.count > STAGE_ROWS)
+            {
+                flush(r, rows, &staged);
+            }
+
+            for (uint8_t f = 0; f < batch.count; f++)
+            {
+                fix_store_row_from_fix(&rows[staged++], batch.device_id, &batch.fixes[f]);
+            }
+
+            r->batches++;
+            r->fixes += batch.count;
+        }
+    }
+
+    flush(r, rows, &staged);
+    return NULL;
+}
+
+/*
+ * Builds the batch of a device after first_fix fixes, one fix per second. Every
+ * device drives straight at its own speed and heading from its own start, with
+ * varying accuracy and satellites, so stored columns look like a fleet's.
+ */
+static void synthetic_batch(struct fix_codec_batch *batch, uint32_t device_id, uint64_t first_fix)
+{
+    double heading = (device_id * 37 % 360) / 57.2957795;
+    double speed = 1.0 + device_id % 15;
+    double lat0 = 60.0 + (device_id % 100) * 0.01;
+    double lon0 = 25.0 + (device_id / 100 % 100) * 0.02;
+
+    batch->device_id = device_id;
+    batch->count = SENDER_FIXES;
+
+    for (int i = 0; i < SENDER_FIXES; i++)
+    {
+        uint64_t n = first_fix + (uint64_t)i;
+        uint32_t noise = (uint32_t)((device_id * 2654435761u) ^ (n * 40503u));
+        double distance = speed * (double)n;
+
+        batch->fixes[i] = (struct fix_codec_fix){
+            .timestamp_ms = SENDER_START_MS + (int64_t)n * 1000,
+            .latitude = lat0 + distance * cos(heading) / 111195.0,
+            .longitude = lon0 + distance * sin(heading) / (111195.0 * cos(lat0 / 57.2957795)),
+            .altitude = 40.0f + (float)(noise % 200) / 100.0f,
+            .accuracy = 2.0f + (float)(noise % 80) / 10.0f,
+            .speed = (float)speed,
+            .heading = (float)(heading * 57.2957795),
+            .sv_used = (uint8_t)(5 + noise % 8),
+            .confidence = (uint8_t)(60 + noise % 40),
+        };
+    }
+}
+
+static void *send_load(void *arg)
+{
+    struct sender *s = arg;
+    struct sockaddr_in dest = {
+        .sin_family = AF_INET,
+        .sin_port = htons(s->port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    static _Thread_local uint8_t buffers[SENDER_BATCHES][FIX_CODEC_MAX_SIZE];
+    struct mmsghdr msgs[SENDER_BATCHES];
+    struct iovec iovs[SENDER_BATCHES];
+    struct fix_codec_batch batch;
+    int fd = open_socket(0, 0);
+
+    if (fd < 0)
+    {
+        perror("sender socket");
+        return NULL;
+    }
+
+    for (int i = 0; i < SENDER_BATCHES; i++)
+    {
+        iovs[i] = (struct iovec){.iov_base = buffers[i]};
+        msgs[i] = (struct mmsghdr){
+            .msg_hdr = {.msg_name = &dest, .msg_namelen = sizeof(dest), .msg_iov = &iovs[i],
+                        .msg_iovlen = 1},
+        };
+    }
+
+    /* Every round, each device of the sender sends its next batch. */
+    for (uint64_t round = 0; !atomic_load(&senders_stop); round++)
+    {
+        for (int i = 0; i < SENDER_BATCHES; i++)
+        {
+            synthetic_batch(&batch, (uint32_t)(s->index * SENDER_BATCHES + i),
+                            round * SENDER_FIXES);
+            iovs[i].iov_len = (size_t)fix_codec_encode(&batch, buffers[i], sizeof(buffers[i]));
+        }
+
+        int n = sendmmsg(fd, msgs, SENDER_BATCHES, 0);
+
+        if (n > 0)
+        {
+            s->batches += (uint64_t)n;
+        }
+        else if (errno != ENOBUFS && errno != EAGAIN)
+        {
+            perror("sendmmsg");
+            break;
+        }
+    }
+
+    close(fd);
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    static struct receiver receivers[MAX_THREADS];
+    static struct sender senders[MAX_THREADS];
+    static struct fix_store store;
+    long port = DEFAULT_PORT;
+    long receiver_count = DEFAULT_RECEIVERS;
+    long sender_count = 0;
+    double duration = 0.0;
+
+    if (argc < 2 || argc % 2 != 0)
+    {
+        fprintf(stderr,
+                "usage: %s <store dir> [-p port] [-r receivers] [-s senders] [-d seconds]\n",
+                argv[0]);
+        return 1;
+    }
+
+    for (int i = 2; i < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-p") == 0)
+        {
+            port = strtol(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            receiver_count = strtol(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            sender_count = strtol(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-d") == 0)
+        {
+            duration = strtod(argv[i + 1], NULL);
+        }
+        else
+        {
+            fprintf(stderr, "invalid option %s %s\n", argv[i], argv[i + 1]);
+            return 1;
+        }
+    }
+
+    if (port <= 0 || port > 65535 || receiver_count < 1 || receiver_count > MAX_THREADS ||
+        sender_count < 0 || sender_count > MAX_THREADS)
+    {
+        fprintf(stderr, "invalid port or thread count (1 to %d)\n", MAX_THREADS);
+        return 1;
+    }
+
+    /* Load tests run for a fixed time, a server until interrupted. */
+    if (sender_count > 0 && duration <= 0.0)
+    {
+        duration = 10.0;
+    }
+
+    if (fix_store_open(&store, argv[1]) != 0)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    uint64_t rows_before = store.rows;
+
+    /* All sockets are bound before any thread runs, so no datagram is lost to a late bind. */
+    for (long i = 0; i < receiver_count; i++)
+    {
+        receivers[i].fd = open_socket((uint16_t)port, 1);
+        receivers[i].store = &store;
+        if (receivers[i].fd < 0)
+        {
+            perror("receiver socket");
+            return 1;
+        }
+    }
+
+    signal(SIGINT, handle_signal);
+    signal(SIGTERM, handle_signal);
+
+    fprintf(stderr, "listening on UDP port %ld with %ld receivers, storing to %s\n", port,
+            receiver_count, argv[1]);
+
+    for (long i = 0; i < receiver_count; i++)
+    {
+        pthread_create(&receivers[i].thread, NULL, receive, &receivers[i]);
+    }
+
+    double start = now_s();
+
+    for (long i = 0; i < sender_count; i++)
+    {
+        senders[i].index = (int)i;
+        senders[i].port = (uint16_t)port;
+        pthread_create(&senders[i].thread, NULL, send_load, &senders[i]);
+    }
+
+    while (!atomic_load(&senders_stop) && (duration <= 0.0 || now_s() - start < duration))
+    {
+        usleep(10000);
+    }
+
+    atomic_store(&senders_stop, true);
+    for (long i = 0; i < sender_count; i++)
+    {
+        pthread_join(senders[i].thread, NULL);
+    }
+
+    double elapsed = now_s() - start;
+
+    /* Let the receivers drain their socket buffers. */
+    usleep(2 * RECV_TIMEOUT_MS * 1000);
+    atomic_store(&receivers_stop, true);
+
+    uint64_t sent = 0, batches = 0, fixes = 0, errors = 0;
+
+    for (long i = 0; i < sender_count; i++)
+    {
+        sent += senders[i].batches;
+    }
+
+    for (long i = 0; i < receiver_count; i++)
+    {
+        pthread_join(receivers[i].thread, NULL);
+        close(receivers[i].fd);
+        batches += receivers[i].batches;
+        fixes += receivers[i].fixes;
+        errors += receivers[i].errors;
+    }
+
+    if (fix_store_close(&store) != 0)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    uint64_t rows_stored = store.rows - rows_before;
+
+    fprintf(stderr, "%.1f s: %llu batches, %llu fixes stored, %llu invalid datagrams\n", elapsed,
+            (unsigned long long)batches, (unsigned long long)rows_stored,
+            (unsigned long long)errors);
+    fprintf(stderr, "%.0f batches/s, %.0f fixes/s\n", batches / elapsed, fixes / elapsed);
+
+    if (sender_count > 0)
+    {
+        fprintf(stderr, "%llu batches sent, %.1f %% received\n", (unsigned long long)sent,
+                sent > 0 ? 100.0 * batches / sent : 0.0);
+    }
+
+    fprintf(stderr, "batches per receiver:");
+    for (long i = 0; i < receiver_count; i++)
+    {
+        fprintf(stderr, " %llu", (unsigned long long)receivers[i].batches);
+    }
+    fprintf(stderr, "\n");
+
+    return 0;
+}
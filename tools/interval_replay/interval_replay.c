@@ -0,0 +1,395 @@
+/*
+Name : interval_replay.c
+
+Description :
+    Host replay harness for components/interval_tuner. Samples a known track
+    with fixes at the intervals chosen by a fix interval strategy and measures
+    the resulting track error: every second between two fixes, the distance
+    between the true position and the straight line between the fixes. Fixed
+    intervals are compared with the learning tuner on GNSS on-time per day, RMS
+    track error (overall and while moving) and the share of the track further
+    than the acceptable error from the fixes, and on the charge per day and
+    per delivered fix from components/energy. The tuner is replayed alone and
+    with a motion sensor that ends the interval MOTION_WAKE_S seconds after
+    the device starts moving.
+
+    Input is a track sampled once per second as "time_s,lat,lon,speed,heading"
+    CSV lines. Without an input file a synthetic commuter track is generated:
+    two weeks of nights at home, days at work and 14 km drives in between.
+
+    Build and run:
+        cc -O2 -I../../components/fast_trig -I../../components/geodesy \
+            -I../../components/interval_tuner -I../../components/energy \
+            interval_replay.c ../../components/interval_tuner/interval_tuner.c \
+            ../../components/energy/energy.c \
+            ../../components/geodesy/geodesy.c \
+            ../../components/fast_trig/fast_trig.c -lm -o interval_replay
+        ./interval_replay [track file]
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "energy.h"
+#include "fast_trig.h"
+#include "interval_tuner.h"
+
+#define METERS_PER_DEG_LAT 111320.0
+#define MAX_ERROR_M 100.0f
+#define GEOHASH_BITS 25
+#define MIN_INTERVAL_S 30
+#define MAX_INTERVAL_S 600
+/* Motion detection and time to fix after a motion wakeup. */
+#define MOTION_WAKE_S 10
+#define FIX_NOISE_M 3.0
+#define MAX_SAMPLES (30 * 86400)
+#define HISTOGRAM_BINS 10000 /* 1 m bins */
+
+/* CPU time and log output of one 1 Hz PVT epoch while GNSS is on. */
+#define CPU_MS_PER_EPOCH 4
+#define LOG_BYTES_PER_EPOCH 600
+
+#define SYNTHETIC_DAYS 14
+#define HOME_LAT 61.4937533
+#define HOME_LON 23.7758897
+#define DRIVE_SPEED 14.0
+#define LEAVE_HOME_S (8 * 3600)
+#define LEAVE_WORK_S (17 * 3600)
+
+struct sample
+{
+    double east; /* m from the first sample */
+    double north;
+    float speed;
+    float heading;
+};
+
+static struct sample track[MAX_SAMPLES];
+static int track_len;
+static double origin_lat;
+static double origin_lon;
+static double meters_per_deg_lon;
+
+static uint32_t histogram[HISTOGRAM_BINS];
+
+/* Commute path vertices, east and north in meters from home. */
+static const double path[][2] = {
+    {0, 0}, {2000, 0}, {2000, 4000}, {7000, 6000}, {7000, 9000},
+};
+
+#define PATH_POINTS (sizeof(path) / sizeof(path[0]))
+
+static double gaussian(void)
+{
+    double u1 = (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+    double u2 = (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Position after driving the given distance along the path, or back. */
+static void path_position(double distance, int reverse, struct sample *s)
+{
+    double total = 0.0;
+
+    for (size_t i = 0; i + 1 < PATH_POINTS; i++)
+    {
+        total += hypot(path[i + 1][0] - path[i][0], path[i + 1][1] - path[i][1]);
+    }
+
+    if (reverse)
+    {
+        distance = total - distance;
+    }
+
+    for (size_t i = 0; i + 1 < PATH_POINTS; i++)
+    {
+        double dx = path[i + 1][0] - path[i][0];
+        double dy = path[i + 1][1] - path[i][1];
+        double len = hypot(dx, dy);
+
+        if (distance <= len || i + 2 == PATH_POINTS)
+        {
+            double f = distance / len;
+            double heading = atan2(dx, dy) * 180.0 / M_PI + (reverse ? 180.0 : 0.0);
+
+            s->east = path[i][0] + f * dx;
+            s->north = path[i][1] + f * dy;
+            s->speed = (float)DRIVE_SPEED;
+            s->heading = (float)fmod(heading + 360.0, 360.0);
+            return;
+        }
+        distance -= len;
+    }
+}
+
+static void synthesize(void)
+{
+    double total = 0.0;
+
+    for (size_t i = 0; i + 1 < PATH_POINTS; i++)
+    {
+        total += hypot(path[i + 1][0] - path[i][0], path[i + 1][1] - path[i][1]);
+    }
+
+    int drive_s = (int)(total / DRIVE_SPEED);
+
+    origin_lat = HOME_LAT;
+    origin_lon = HOME_LON;
+    track_len = SYNTHETIC_DAYS * 86400;
+
+    for (int t = 0; t < track_len; t++)
+    {
+        int day_s = t % 86400;
+        struct sample *s = &track[t];
+
+        if (day_s >= LEAVE_HOME_S && day_s < LEAVE_HOME_S + drive_s)
+        {
+            path_position((day_s - LEAVE_HOME_S) * DRIVE_SPEED, 0, s);
+        }
+        else if (day_s >= LEAVE_WORK_S && day_s < LEAVE_WORK_S + drive_s)
+        {
+            path_position((day_s - LEAVE_WORK_S) * DRIVE_SPEED, 1, s);
+        }
+        else
+        {
+            int at_work = day_s >= LEAVE_HOME_S && day_s < LEAVE_WORK_S;
+
+            s->east = at_work ? path[PATH_POINTS - 1][0] : 0.0;
+            s->north = at_work ? path[PATH_POINTS - 1][1] : 0.0;
+            s->speed = 0.0f;
+            s->heading = 0.0f;
+        }
+    }
+}
+
+static int load(const char *path_name)
+{
+    FILE *f = fopen(path_name, "r");
+    char line[256];
+
+    if (f == NULL)
+    {
+        perror(path_name);
+        return -1;
+    }
+
+    while (track_len < MAX_SAMPLES && fgets(line, sizeof(line), f) != NULL)
+    {
+        double t, lat, lon;
+        float speed, heading;
+
+        if (sscanf(line, "%lf,%lf,%lf,%f,%f", &t, &lat, &lon, &speed, &heading) != 5)
+        {
+            continue;
+        }
+
+        if (track_len == 0)
+        {
+            origin_lat = lat;
+            origin_lon = lon;
+            meters_per_deg_lon = METERS_PER_DEG_LAT * cos(origin_lat * M_PI / 180.0);
+        }
+
+        track[track_len].east = (lon - origin_lon) * meters_per_deg_lon;
+        track[track_len].north = (lat - origin_lat) * METERS_PER_DEG_LAT;
+        track[track_len].speed = speed;
+        track[track_len].heading = heading;
+        track_len++;
+    }
+
+    fclose(f);
+    return track_len;
+}
+
+/* GNSS on-time of a fix after the given interval: hot start, slightly slower
+ * the longer GNSS was off. */
+static uint32_t on_time_ms(uint32_t interval_s)
+{
+    return 1200 + 2 * interval_s;
+}
+
+/* First second in (from, to) at which the device starts moving, 0 if none. */
+static int trip_start_find(int from, int to)
+{
+    for (int k = from + 1; k < to && k < track_len; k++)
+    {
+        if (track[k].speed > 0.0f && track[k - 1].speed == 0.0f)
+        {
+            return k;
+        }
+    }
+
+    return 0;
+}
+
+/* Replays the track with a fixed interval, or with the tuner if interval_s is
+ * zero (woken by motion if motion_wake is set), and prints one result line. */
+static void replay(uint32_t interval_s, bool motion_wake)
+{
+    struct interval_tuner tuner;
+    struct energy_account energy;
+    double on_ms = 0.0;
+    double sum_sq = 0.0;
+    double moving_sum_sq = 0.0;
+    uint32_t count = 0;
+    uint32_t moving_count = 0;
+    uint32_t fixes = 0;
+    uint32_t used[INTERVAL_TUNER_ARMS] = {0};
+
+    interval_tuner_init(&tuner, MAX_ERROR_M, GEOHASH_BITS, MIN_INTERVAL_S, MAX_INTERVAL_S);
+    energy_init(&energy, &energy_model_nrf91);
+    energy_add_us(&energy, ENERGY_IDLE, (uint64_t)track_len * 1000000);
+    srand(2);
+
+    for (int i = 0; i < HISTOGRAM_BINS; i++)
+    {
+        histogram[i] = 0;
+    }
+
+    int t = 0;
+    uint32_t interval = interval_s;
+    double prev_e = 0.0, prev_n = 0.0;
+
+    while (t < track_len)
+    {
+        const struct sample *s = &track[t];
+        double e = s->east + FIX_NOISE_M * gaussian();
+        double n = s->north + FIX_NOISE_M * gaussian();
+        uint32_t fix_on_ms = on_time_ms(interval);
+
+        uint32_t epochs = (fix_on_ms + 999) / 1000;
+
+        energy_add_us(&energy, ENERGY_GNSS, (uint64_t)fix_on_ms * 1000);
+        energy_add_us(&energy, ENERGY_CPU, (uint64_t)epochs * CPU_MS_PER_EPOCH * 1000);
+        energy_add_uart_bytes(&energy, epochs * LOG_BYTES_PER_EPOCH);
+        energy_fix_delivered(&energy);
+
+        if (fixes > 0)
+        {
+            on_ms += fix_on_ms;
+
+            /* Error of the straight line between the fixes, every second. */
+            for (uint32_t k = 1; k <= interval; k++)
+            {
+                const struct sample *truth = &track[t - interval + k];
+                double f = (double)k / interval;
+                double err = hypot(prev_e + f * (e - prev_e) - truth->east,
+                                   prev_n + f * (n - prev_n) - truth->north);
+                int bin = err < HISTOGRAM_BINS - 1 ? (int)err : HISTOGRAM_BINS - 1;
+
+                histogram[bin]++;
+                sum_sq += err * err;
+                count++;
+                if (truth->speed > 0.0f)
+                {
+                    moving_sum_sq += err * err;
+                    moving_count++;
+                }
+            }
+        }
+
+        if (interval_s == 0)
+        {
+            struct interval_tuner_fix fix = {
+                .latitude = origin_lat + n / METERS_PER_DEG_LAT,
+                .longitude = origin_lon + e / meters_per_deg_lon,
+                .speed = s->speed,
+                .heading = s->heading,
+                .time_ms = (int64_t)t * 1000,
+            };
+
+            interval = interval_tuner_next(&tuner, &fix, fix_on_ms);
+            for (int a = 0; a < INTERVAL_TUNER_ARMS; a++)
+            {
+                used[a] += interval == tuner.intervals_s[a];
+            }
+
+            int start = motion_wake ? trip_start_find(t, t + (int)interval) : 0;
+
+            if (start != 0 && start + MOTION_WAKE_S < t + (int)interval)
+            {
+                interval_tuner_wake(&tuner);
+                interval = (uint32_t)(start + MOTION_WAKE_S - t);
+            }
+        }
+
+        prev_e = e;
+        prev_n = n;
+        fixes++;
+        t += interval;
+    }
+
+    uint32_t over = 0;
+
+    for (int i = (int)MAX_ERROR_M; i < HISTOGRAM_BINS; i++)
+    {
+        over += histogram[i];
+    }
+
+    double days = track_len / 86400.0;
+    char label[32];
+
+    if (interval_s == 0)
+    {
+        snprintf(label, sizeof(label), motion_wake ? "tuner+motion" : "tuner");
+    }
+    else
+    {
+        snprintf(label, sizeof(label), "fixed %u s", interval_s);
+    }
+
+    printf("%-12s %10.0f %14.0f %12.1f %13.2f %14.1f %10.0f %10.1f\n", label, fixes / days,
+           on_ms / 1000.0 / days, sqrt(sum_sq / count), 100.0 * over / count,
+           moving_count > 0 ? sqrt(moving_sum_sq / moving_count) : 0.0,
+           energy_total_mas(&energy) / days, energy_per_fix_mas(&energy));
+
+    if (interval_s == 0)
+    {
+        printf("%14s", "chosen:");
+        for (int a = 0; a < INTERVAL_TUNER_ARMS; a++)
+        {
+            printf(" %u s %.1f%%", tuner.intervals_s[a], 100.0 * used[a] / fixes);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+    {
+        if (load(argv[1]) <= 0)
+        {
+            fprintf(stderr, "No track samples\n");
+            return 1;
+        }
+    }
+    else
+    {
+        synthesize();
+    }
+    meters_per_deg_lon = METERS_PER_DEG_LAT * cos(origin_lat * M_PI / 180.0);
+
+    printf("%.1f days of track (%s), acceptable error %.0f m\n\n", track_len / 86400.0,
+           argc > 1 ? argv[1] : "synthetic", (double)MAX_ERROR_M);
+    printf("%-12s %10s %14s %12s %13s %14s %10s %10s\n", "strategy", "fixes/day",
+           "on-time s/day", "RMS error m", "over limit %", "moving RMS m", "mAs/day", "mAs/fix");
+
+    struct interval_tuner tuner;
+
+    interval_tuner_init(&tuner, MAX_ERROR_M, GEOHASH_BITS, MIN_INTERVAL_S, MAX_INTERVAL_S);
+    for (int a = 0; a < INTERVAL_TUNER_ARMS; a++)
+    {
+        replay(tuner.intervals_s[a], false);
+    }
+    replay(0, false);
+    replay(0, true);
+
+    return 0;
+}
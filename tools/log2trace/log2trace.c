@@ -0,0 +1,422 @@
+/*
+Name : log2trace.c
+
+Description :
+    Converts text console logs of the sample (UART captures of the satellite
+    statistics, status reports and fix data printed every epoch) into the
+    binary trace format of tools/trace, so recorded field logs can be replayed.
+
+    Every "Tracking:" line starts an epoch; the fix lines that follow fill it
+    and status reports ("GNSS operation blocked by LTE" ... "cleared after")
+    set its flags while the condition lasts. Logs from before the reports were
+    rate-limited print the report in every epoch with the condition and never
+    "cleared after", so until a periodic or clearing report shows the newer
+    format, a report only flags the epoch it is printed in. ANSI escape sequences from
+    refresh_display() and log colors, carriage returns and the Zephyr log
+    prefix ("[hh:mm:ss.mmm,uuu] <inf> GNSS: ", used as the epoch uptime) are
+    stripped, so raw captures with or without terminal refresh work. Binary
+    (dictionary) logs are not supported.
+
+    The log is streamed line by line with fixed buffers, so memory use does not
+    depend on its size. Use "-" to read from standard input, e.g. from zcat.
+
+    Build and run:
+        cc -O2 -I../trace -I../../components/gnss_time log2trace.c ../trace/trace.c \
+            ../../components/gnss_time/gnss_time.c -o log2trace
+        ./log2trace <log file | -> <trace file>
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gnss_time.h"
+#include "trace.h"
+
+#define LINE_SIZE 1024
+#define READ_BUFFER_SIZE (1024 * 1024)
+
+/* Fix lines of print_fix_data() and the epoch field they fill. */
+struct fix_field
+{
+    const char *label;
+    size_t label_len;
+    size_t offset;
+    bool is_double;
+};
+
+#define FIELD(label, member, is_double) \
+    {label, sizeof(label) - 1, offsetof(struct trace_epoch, member), is_double}
+
+static const struct fix_field fix_fields[] = {
+    FIELD("Latitude:", latitude, true),
+    FIELD("Longitude:", longitude, true),
+    FIELD("Accuracy:", accuracy, false),
+    FIELD("Altitude:", altitude, false),
+    FIELD("Altitude accuracy:", altitude_accuracy, false),
+    FIELD("Speed:", speed, false),
+    FIELD("Speed accuracy:", speed_accuracy, false),
+    FIELD("V. speed:", vertical_speed, false),
+    FIELD("V. speed accuracy:", vertical_speed_accuracy, false),
+    FIELD("Heading:", heading, false),
+    FIELD("Heading accuracy:", heading_accuracy, false),
+    FIELD("PDOP:", pdop, false),
+    FIELD("HDOP:", hdop, false),
+    FIELD("VDOP:", vdop, false),
+    FIELD("TDOP:", tdop, false),
+};
+
+/* Status reports of print_flags() and the flag they stand for. */
+static const struct
+{
+    const char *name;
+    uint8_t flag;
+} status_reports[] = {
+    {"GNSS operation blocked by LTE", TRACE_FLAG_DEADLINE_MISSED},
+    {"Insufficient GNSS time windows", TRACE_FLAG_NOT_ENOUGH_WINDOW_TIME},
+    {"Sleep period(s) between PVT notifications", TRACE_FLAG_SLEEP_BETWEEN_PVT},
+    {"Scheduled navigation data download", TRACE_FLAG_SCHED_DOWNLOAD},
+};
+
+struct converter
+{
+    struct trace_writer writer;
+    struct trace_epoch epoch;
+    bool in_epoch;
+    uint8_t status_flags;
+    /* Status reports only log changes, so their flags last between them. */
+    bool status_sticky;
+
+    /* Date of the current fix, the time line follows it. */
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+
+    uint64_t lines;
+    uint64_t long_lines;
+    uint64_t epochs;
+    uint64_t fixes;
+};
+
+static bool starts_with(const char *s, const char *prefix)
+{
+    return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+/* Removes ANSI CSI sequences (ESC [ params final) and control characters in place. */
+static void strip_line(char *line)
+{
+    char *out = line;
+
+    for (const char *in = line; *in != '\0'; in++)
+    {
+        if (*in == '\033')
+        {
+            if (in[1] == '[')
+            {
+                in += 2;
+                while (*in != '\0' && (*in < 0x40 || *in > 0x7e))
+                {
+                    in++;
+                }
+                if (*in == '\0')
+                {
+                    break;
+                }
+            }
+            continue;
+        }
+
+        if ((unsigned char)*in >= ' ' || *in == '\t')
+        {
+            *out++ = *in;
+        }
+    }
+
+    *out = '\0';
+}
+
+/* Parses the digits at *s, returns -1 if there are none. */
+static int64_t parse_number(const char **s)
+{
+    int64_t value = 0;
+    const char *start = *s;
+
+    while (**s >= '0' && **s <= '9')
+    {
+        value = value * 10 + (**s - '0');
+        (*s)++;
+    }
+
+    return *s == start ? -1 : value;
+}
+
+/* Parses "[hh:mm:ss.mmm,uuu] <lvl> MODULE: message", returns the message. */
+static const char *parse_prefix(const char *line, int64_t *uptime_ms)
+{
+    const char *msg = line;
+
+    *uptime_ms = -1;
+
+    if (line[0] == '[')
+    {
+        const char *p = line + 1;
+        int64_t h = parse_number(&p);
+        int64_t m = *p == ':' ? (p++, parse_number(&p)) : -1;
+        int64_t s = *p == ':' ? (p++, parse_number(&p)) : -1;
+        int64_t ms = *p == '.' ? (p++, parse_number(&p)) : -1;
+
+        if (h >= 0 && m >= 0 && s >= 0 && ms >= 0)
+        {
+            *uptime_ms = ((h * 60 + m) * 60 + s) * 1000 + ms;
+        }
+
+        const char *end = strchr(p, ']');
+
+        msg = end != NULL ? end + 1 : line;
+    }
+
+    while (*msg == ' ')
+    {
+        msg++;
+    }
+
+    if (msg[0] == '<')
+    {
+        const char *level_end = strchr(msg, '>');
+        const char *module_end = level_end != NULL ? strstr(level_end, ": ") : NULL;
+
+        if (module_end != NULL)
+        {
+            msg = module_end + 2;
+        }
+    }
+
+    return msg;
+}
+
+static int epoch_end(struct converter *c)
+{
+    if (!c->in_epoch)
+    {
+        return 0;
+    }
+
+    c->in_epoch = false;
+    c->epochs++;
+    c->fixes += (c->epoch.flags & TRACE_FLAG_FIX_VALID) != 0;
+
+    return trace_write_epoch(&c->writer, &c->epoch);
+}
+
+static int handle_line(struct converter *c, char *line)
+{
+    int64_t uptime_ms;
+    const char *msg;
+
+    strip_line(line);
+    msg = parse_prefix(line, &uptime_ms);
+
+    if (starts_with(msg, "Tracking:"))
+    {
+        int tracked, in_fix, unhealthy;
+
+        if (sscanf(msg, "Tracking: %d Using: %d Unhealthy: %d", &tracked, &in_fix,
+                   &unhealthy) != 3)
+        {
+            return 0;
+        }
+
+        if (epoch_end(c) != 0)
+        {
+            return -1;
+        }
+
+        memset(&c->epoch, 0, sizeof(c->epoch));
+        c->epoch.uptime_ms = uptime_ms;
+        c->epoch.flags = c->status_sticky ? c->status_flags : 0;
+        c->epoch.tracked = (uint8_t)tracked;
+        c->epoch.in_fix = (uint8_t)in_fix;
+        c->epoch.unhealthy = (uint8_t)unhealthy;
+        c->year = 0;
+        c->in_epoch = true;
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(status_reports) / sizeof(status_reports[0]); i++)
+    {
+        if (starts_with(msg, status_reports[i].name))
+        {
+            if (strstr(msg, " cleared after ") != NULL)
+            {
+                c->status_sticky = true;
+                c->status_flags &= ~status_reports[i].flag;
+            }
+            else
+            {
+                c->status_sticky = c->status_sticky || strstr(msg, " epochs, +") != NULL;
+                c->status_flags |= status_reports[i].flag;
+            }
+
+            if (c->status_sticky)
+            {
+                c->epoch.flags = (c->epoch.flags & TRACE_FLAG_FIX_VALID) | c->status_flags;
+            }
+            else
+            {
+                c->epoch.flags |= status_reports[i].flag;
+            }
+            return 0;
+        }
+    }
+
+    /* Fix lines only belong to an epoch whose start was seen. */
+    if (!c->in_epoch)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < sizeof(fix_fields) / sizeof(fix_fields[0]); i++)
+    {
+        const struct fix_field *f = &fix_fields[i];
+
+        if (strncmp(msg, f->label, f->label_len) == 0)
+        {
+            double value = strtod(msg + f->label_len, NULL);
+            uint8_t *field = (uint8_t *)&c->epoch + f->offset;
+
+            if (f->is_double)
+            {
+                memcpy(field, &value, sizeof(value));
+            }
+            else
+            {
+                float v = (float)value;
+
+                memcpy(field, &v, sizeof(v));
+            }
+
+            c->epoch.flags |= TRACE_FLAG_FIX_VALID;
+            return 0;
+        }
+    }
+
+    if (starts_with(msg, "Date:"))
+    {
+        unsigned int year, month, day;
+
+        if (sscanf(msg, "Date: %u-%u-%u", &year, &month, &day) == 3)
+        {
+            c->year = (uint16_t)year;
+            c->month = (uint8_t)month;
+            c->day = (uint8_t)day;
+        }
+    }
+    else if (starts_with(msg, "Time (UTC):"))
+    {
+        unsigned int hour, minute, seconds, ms;
+
+        if (c->year != 0 &&
+            sscanf(msg, "Time (UTC): %u:%u:%u.%u", &hour, &minute, &seconds, &ms) == 4)
+        {
+            c->epoch.utc_ms = gnss_time_utc_ms(c->year, c->month, c->day, (uint8_t)hour,
+                                               (uint8_t)minute, (uint8_t)seconds,
+                                               (uint16_t)ms);
+        }
+    }
+    else if (starts_with(msg, "Confidence:"))
+    {
+        c->epoch.confidence = (uint8_t)strtoul(msg + strlen("Confidence:"), NULL, 10);
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static char line[LINE_SIZE];
+    struct converter c = {0};
+    struct timespec start, end;
+    FILE *in;
+    uint64_t bytes = 0;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <log file | -> <trace file>\n", argv[0]);
+        return 1;
+    }
+
+    in = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], "rb");
+    if (in == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    setvbuf(in, NULL, _IOFBF, READ_BUFFER_SIZE);
+
+    if (trace_writer_open(&c.writer, argv[2]) != 0)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        size_t len = strlen(line);
+
+        bytes += len;
+
+        /* Skip the rest of lines longer than the buffer (e.g. binary noise). */
+        if (len == sizeof(line) - 1 && line[len - 1] != '\n')
+        {
+            int ch;
+
+            while ((ch = fgetc(in)) != EOF && ch != '\n')
+            {
+                bytes++;
+            }
+            c.long_lines++;
+            continue;
+        }
+
+        c.lines++;
+        if (handle_line(&c, line) != 0)
+        {
+            perror(argv[2]);
+            return 1;
+        }
+    }
+
+    if (epoch_end(&c) != 0 || trace_writer_close(&c.writer) != 0)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    fprintf(stderr,
+            "%llu lines (%llu too long), %llu epochs, %llu fixes\n"
+            "%.1f MB log -> %.1f MB trace in %.2f s (%.0f MB/s)\n",
+            (unsigned long long)c.lines, (unsigned long long)c.long_lines,
+            (unsigned long long)c.epochs, (unsigned long long)c.fixes, bytes / 1e6,
+            c.writer.bytes / 1e6, seconds, seconds > 0.0 ? bytes / 1e6 / seconds : 0.0);
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    return 0;
+}
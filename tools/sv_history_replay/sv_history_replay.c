@@ -0,0 +1,341 @@
+/*
+Name : sv_history_replay.c
+
+Description :
+    Host replay harness for components/sv_history. Simulates a day of 1 Hz PVT
+    epochs of a static receiver: GPS and QZSS satellites rise and set, are
+    tracked in up to 12 modem slots above the elevation mask, have CN0 noise
+    and are used in the fix once their ephemeris is decoded. Periodic
+    blockages (e.g. passing vehicles or moving indoors) drop the satellites on
+    one side and attenuate the rest.
+
+    Every epoch is encoded for several keyframe intervals, decoded again and
+    compared with the simulated satellites, and also decoded starting in the
+    middle of the history. The history size is compared with the raw sv[]
+    array of every epoch (NRF_MODEM_GNSS_MAX_SATELLITES x 12 bytes) and with
+    only the tracked entries.
+
+    Build and run:
+        cc -O2 -I../../components/sv_history sv_history_replay.c \
+            ../../components/sv_history/sv_history.c -lm -o sv_history_replay
+        ./sv_history_replay
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sv_history.h"
+
+#define DURATION_S (24 * 3600)
+#define START_MS 1000000LL
+
+/* sizeof(struct nrf_modem_gnss_sv) */
+#define RAW_SV_SIZE 12
+
+#define GPS_COUNT 31
+#define QZSS_COUNT 4
+#define SAT_COUNT (GPS_COUNT + QZSS_COUNT)
+#define SIGNAL_GPS_L1CA 1
+#define SIGNAL_QZSS_L1CA 3
+
+#define SV_FLAG_USED_IN_FIX 0x02
+#define SV_FLAG_UNHEALTHY 0x08
+
+#define ELEVATION_MASK 5.0
+#define USE_MIN_ELEVATION 10.0
+#define USE_MIN_CN0 300
+#define EPHEMERIS_DECODE_S 30
+
+/* CN0 in 0.1 dB-Hz: base, per degree of elevation and noise. */
+#define CN0_BASE 280.0
+#define CN0_PER_DEGREE 1.6
+#define CN0_NOISE 8.0
+
+#define BLOCKAGE_INTERVAL_S 900
+#define BLOCKAGE_S 40
+#define BLOCKAGE_ATTENUATION 80.0
+
+static const uint16_t keyframe_intervals[] = {60, 300, 3600};
+#define INTERVALS (sizeof(keyframe_intervals) / sizeof(keyframe_intervals[0]))
+
+struct satellite
+{
+    uint16_t prn;
+    uint8_t signal;
+    bool unhealthy;
+    double period_s;
+    double phase;
+    double max_elevation;
+    double azimuth0;
+    double azimuth_rate;
+    int64_t tracked_since;
+};
+
+static struct satellite sats[SAT_COUNT];
+
+static double uniform(void)
+{
+    return (rand() + 1.0) / (RAND_MAX + 2.0);
+}
+
+static double gauss(void)
+{
+    return sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform());
+}
+
+static void constellation_init(void)
+{
+    for (int i = 0; i < SAT_COUNT; i++)
+    {
+        struct satellite *s = &sats[i];
+        bool qzss = i >= GPS_COUNT;
+
+        s->prn = qzss ? (uint16_t)(193 + i - GPS_COUNT) : (uint16_t)(i < 30 ? i + 1 : 32);
+        s->signal = qzss ? SIGNAL_QZSS_L1CA : SIGNAL_GPS_L1CA;
+        s->unhealthy = i == 7;
+        /* GPS orbits twice per sidereal day, QZSS stays high over Asia once a day. */
+        s->period_s = qzss ? 86164.0 : 43082.0;
+        s->phase = 2.0 * M_PI * uniform();
+        s->max_elevation = qzss ? 30.0 + 40.0 * uniform() : 35.0 + 53.0 * uniform();
+        s->azimuth0 = 360.0 * uniform();
+        s->azimuth_rate = (uniform() < 0.5 ? -1.0 : 1.0) * 180.0 / s->period_s;
+        s->tracked_since = -1;
+    }
+}
+
+/* Fills the modem slots for second t, keeping satellites in their slots. */
+static void epoch_simulate(int64_t t, struct sv_history_sv slots[SV_HISTORY_MAX_SV])
+{
+    bool blocked = t % BLOCKAGE_INTERVAL_S < BLOCKAGE_S;
+    double blocked_azimuth = fmod((double)(t / BLOCKAGE_INTERVAL_S) * 137.0, 360.0);
+    bool visible[SAT_COUNT];
+    double elevation[SAT_COUNT];
+    double azimuth[SAT_COUNT];
+
+    for (int i = 0; i < SAT_COUNT; i++)
+    {
+        const struct satellite *s = &sats[i];
+        double side;
+
+        elevation[i] = s->max_elevation * sin(s->phase + 2.0 * M_PI * (double)t / s->period_s);
+        azimuth[i] = fmod(s->azimuth0 + s->azimuth_rate * (double)t + 720.0, 360.0);
+        side = fabs(fmod(azimuth[i] - blocked_azimuth + 540.0, 360.0) - 180.0);
+        visible[i] = elevation[i] > ELEVATION_MASK && !(blocked && side < 90.0);
+    }
+
+    /* Lost satellites free their slots. */
+    for (int k = 0; k < SV_HISTORY_MAX_SV; k++)
+    {
+        for (int i = 0; i < SAT_COUNT && slots[k].sv != 0; i++)
+        {
+            if (sats[i].prn == slots[k].sv && !visible[i])
+            {
+                slots[k].sv = 0;
+                sats[i].tracked_since = -1;
+            }
+        }
+    }
+
+    for (int i = 0; i < SAT_COUNT; i++)
+    {
+        struct satellite *s = &sats[i];
+        int slot = -1;
+
+        if (!visible[i])
+        {
+            continue;
+        }
+
+        for (int k = 0; k < SV_HISTORY_MAX_SV && slot < 0; k++)
+        {
+            slot = slots[k].sv == s->prn ? k : -1;
+        }
+        for (int k = 0; k < SV_HISTORY_MAX_SV && slot < 0; k++)
+        {
+            slot = slots[k].sv == 0 ? k : -1;
+        }
+        if (slot < 0)
+        {
+            continue;
+        }
+
+        if (s->tracked_since < 0)
+        {
+            s->tracked_since = t;
+        }
+
+        double cn0 = CN0_BASE + CN0_PER_DEGREE * elevation[i] + CN0_NOISE * gauss() -
+                     (blocked ? BLOCKAGE_ATTENUATION : 0.0);
+        struct sv_history_sv *sv = &slots[slot];
+
+        sv->sv = s->prn;
+        sv->signal = s->signal;
+        sv->cn0 = (uint16_t)(cn0 > 0.0 ? lround(cn0) : 0);
+        sv->elevation = (int16_t)lround(elevation[i]);
+        sv->azimuth = (int16_t)lround(azimuth[i]) % 360;
+        sv->flags = s->unhealthy ? SV_FLAG_UNHEALTHY : 0;
+        if (!s->unhealthy && t - s->tracked_since >= EPHEMERIS_DECODE_S &&
+            elevation[i] >= USE_MIN_ELEVATION && sv->cn0 >= USE_MIN_CN0)
+        {
+            sv->flags |= SV_FLAG_USED_IN_FIX;
+        }
+    }
+}
+
+static int sv_compare(const void *a, const void *b)
+{
+    const struct sv_history_sv *x = a;
+    const struct sv_history_sv *y = b;
+
+    return x->sv != y->sv ? x->sv - y->sv : x->signal - y->signal;
+}
+
+/* Satellites of an epoch in a canonical order, to compare decoded epochs. */
+static void epoch_sort(struct sv_history_epoch *epoch)
+{
+    qsort(epoch->sv, epoch->count, sizeof(epoch->sv[0]), sv_compare);
+}
+
+static bool epoch_equal(struct sv_history_epoch a, struct sv_history_epoch b)
+{
+    epoch_sort(&a);
+    epoch_sort(&b);
+
+    if (a.time_ms != b.time_ms || a.count != b.count)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < a.count; i++)
+    {
+        if (memcmp(&a.sv[i], &b.sv[i], sizeof(a.sv[i])) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static struct sv_history_epoch epochs[DURATION_S];
+    struct sv_history_sv slots[SV_HISTORY_MAX_SV] = {0};
+    uint64_t tracked = 0;
+
+    srand(1);
+    constellation_init();
+
+    for (int64_t t = 0; t < DURATION_S; t++)
+    {
+        struct sv_history_epoch *e = &epochs[t];
+
+        epoch_simulate(t, slots);
+        e->time_ms = START_MS + t * 1000;
+        /* Like gnss.c, empty slots are not part of the epoch. */
+        for (int k = 0; k < SV_HISTORY_MAX_SV; k++)
+        {
+            if (slots[k].sv != 0)
+            {
+                e->sv[e->count++] = slots[k];
+            }
+        }
+        tracked += e->count;
+    }
+
+    uint64_t raw = (uint64_t)DURATION_S * SV_HISTORY_MAX_SV * RAW_SV_SIZE;
+    uint64_t raw_tracked = tracked * RAW_SV_SIZE;
+
+    printf("%d epochs, %.1f satellites tracked on average\n", DURATION_S,
+           (double)tracked / DURATION_S);
+    printf("raw sv[] arrays %.2f MB, tracked entries only %.2f MB\n\n", raw / 1e6,
+           raw_tracked / 1e6);
+    printf("| Keyframe interval | History | Bytes/epoch | vs sv[] | vs tracked | Encode |\n");
+    printf("|---|---|---|---|---|---|\n");
+
+    for (size_t n = 0; n < INTERVALS; n++)
+    {
+        static uint8_t history[DURATION_S * SV_HISTORY_RECORD_MAX_SIZE];
+        struct sv_history_codec codec;
+        struct sv_history_epoch decoded;
+        struct timespec start, end;
+        size_t len = 0;
+        int errors = 0;
+
+        sv_history_init(&codec, keyframe_intervals[n]);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+
+        for (int t = 0; t < DURATION_S; t++)
+        {
+            int r = sv_history_encode(&codec, &epochs[t], history + len,
+                                      sizeof(history) - len);
+
+            if (r < 0)
+            {
+                fprintf(stderr, "encode failed at epoch %d\n", t);
+                return 1;
+            }
+            len += (size_t)r;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double encode_us = ((double)(end.tv_sec - start.tv_sec) * 1e9 +
+                            (double)(end.tv_nsec - start.tv_nsec)) / 1e3 / DURATION_S;
+
+        /* Decode all of it, then starting from a record in the middle. */
+        for (int pass = 0; pass < 2; pass++)
+        {
+            size_t offset = 0;
+            int t = 0;
+
+            if (pass == 1)
+            {
+                for (; t < DURATION_S / 2 + 7; t++)
+                {
+                    offset += (size_t)history[offset] + 1;
+                }
+            }
+
+            sv_history_init(&codec, 0);
+
+            while (offset < len)
+            {
+                int r = sv_history_decode(&codec, history + offset, len - offset, &decoded);
+
+                if (r < 0)
+                {
+                    errors++;
+                    break;
+                }
+
+                if (r > 0 && !epoch_equal(decoded, epochs[t]))
+                {
+                    errors++;
+                }
+
+                offset += (size_t)history[offset] + 1;
+                t++;
+            }
+        }
+
+        printf("| %u | %.2f MB | %.1f | %.1fx | %.1fx | %.1f us |%s\n", keyframe_intervals[n],
+               len / 1e6, (double)len / DURATION_S, (double)raw / len,
+               (double)raw_tracked / len, encode_us, errors ? " DECODE ERRORS" : "");
+
+        if (errors)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,548 @@
+/*
+Name : trace.c
+
+Description :
+    This source file implements the binary GNSS trace format declared in
+    trace.h. Records are written through a large stdio buffer and index
+    entries staged in a temporary file, so converters can stream traces of any
+    length with constant memory. Traces are read by mapping them: epochs are
+    found through the footer index by number or by binary search on time.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "trace.h"
+
+#define WRITE_BUFFER_SIZE (1024 * 1024)
+
+/*
+Function : index_entry_set
+
+Description :
+    Fills the index entry of an epoch record. Epochs without a fix get the
+    previous index time advanced by their uptime, so the index time never
+    decreases (also over device resets in a log).
+
+Parameter :
+    struct trace_index_entry *entry      - Entry to fill
+    const struct trace_index_entry *prev - Entry of the previous epoch, NULL if none
+    const struct trace_epoch *epoch      - Epoch
+    uint64_t offset                      - File offset of the epoch record
+
+Return :
+    void
+
+Example Call :
+    index_entry_set(&entry, &prev, epoch, offset);
+*/
+static void index_entry_set(struct trace_index_entry *entry,
+                            const struct trace_index_entry *prev,
+                            const struct trace_epoch *epoch, uint64_t offset)
+{
+    int64_t prev_utc = prev != NULL ? prev->utc_ms : 0;
+    int64_t utc = prev_utc;
+
+    if ((epoch->flags & TRACE_FLAG_FIX_VALID) && epoch->utc_ms != 0)
+    {
+        utc = epoch->utc_ms;
+    }
+    else if (prev_utc != 0 && prev->uptime_ms >= 0 && epoch->uptime_ms > prev->uptime_ms)
+    {
+        utc += epoch->uptime_ms - prev->uptime_ms;
+    }
+
+    entry->offset = offset;
+    entry->uptime_ms = epoch->uptime_ms;
+    entry->utc_ms = utc > prev_utc ? utc : prev_utc;
+}
+
+/*
+Function : trace_writer_open
+
+Description :
+    Creates a trace file and writes its header.
+
+Parameter :
+    struct trace_writer *writer - Writer
+    const char *path            - Output path
+
+Return :
+    int - 0 on success, -1 on failure
+
+Example Call :
+    if (trace_writer_open(&writer, "drive.trace") != 0) { ... }
+*/
+int trace_writer_open(struct trace_writer *writer, const char *path)
+{
+    struct trace_file_header header = {
+        .magic = TRACE_MAGIC,
+        .version = TRACE_VERSION,
+        .header_size = sizeof(header),
+    };
+
+    memset(writer, 0, sizeof(*writer));
+    writer->index = tmpfile();
+    if (writer->index == NULL)
+    {
+        return -1;
+    }
+
+    writer->file = fopen(path, "wb");
+    if (writer->file == NULL)
+    {
+        fclose(writer->index);
+        return -1;
+    }
+
+    setvbuf(writer->file, NULL, _IOFBF, WRITE_BUFFER_SIZE);
+
+    if (fwrite(&header, sizeof(header), 1, writer->file) != 1)
+    {
+        fclose(writer->file);
+        fclose(writer->index);
+        writer->file = NULL;
+        return -1;
+    }
+
+    writer->bytes = sizeof(header);
+    return 0;
+}
+
+/*
+Function : trace_write
+
+Description :
+    Appends a record, padding its payload to TRACE_ALIGN bytes.
+
+Parameter :
+    struct trace_writer *writer - Writer
+    uint16_t type               - Record type, enum trace_record_type
+    const void *payload         - Payload
+    uint16_t length             - Payload length in bytes
+
+Return :
+    int - 0 on success, -1 on failure
+
+Example Call :
+    trace_write(&writer, TRACE_RECORD_NMEA, sentence, strlen(sentence));
+*/
+int trace_write(struct trace_writer *writer, uint16_t type, const void *payload,
+                uint16_t length)
+{
+    static const uint8_t padding[TRACE_ALIGN];
+    struct trace_record_header header = {
+        .type = type,
+        .length = length,
+    };
+    size_t pad = (TRACE_ALIGN - length % TRACE_ALIGN) % TRACE_ALIGN;
+
+    if (fwrite(&header, sizeof(header), 1, writer->file) != 1 ||
+        fwrite(payload, 1, length, writer->file) != length ||
+        fwrite(padding, 1, pad, writer->file) != pad)
+    {
+        return -1;
+    }
+
+    writer->records++;
+    writer->bytes += sizeof(header) + length + pad;
+    return 0;
+}
+
+/*
+Function : trace_write_epoch
+
+Description :
+    Appends a PVT epoch record and its index entry.
+
+Parameter :
+    struct trace_writer *writer     - Writer
+    const struct trace_epoch *epoch - Epoch
+
+Return :
+    int - 0 on success, -1 on failure
+
+Example Call :
+    trace_write_epoch(&writer, &epoch);
+*/
+int trace_write_epoch(struct trace_writer *writer, const struct trace_epoch *epoch)
+{
+    struct trace_index_entry prev = {
+        .uptime_ms = writer->last_uptime_ms,
+        .utc_ms = writer->last_utc_ms,
+    };
+    struct trace_index_entry entry;
+
+    index_entry_set(&entry, writer->epochs > 0 ? &prev : NULL, epoch, writer->bytes);
+
+    if (fwrite(&entry, sizeof(entry), 1, writer->index) != 1 ||
+        trace_write(writer, TRACE_RECORD_EPOCH, epoch, sizeof(*epoch)) != 0)
+    {
+        return -1;
+    }
+
+    writer->epochs++;
+    writer->last_uptime_ms = entry.uptime_ms;
+    writer->last_utc_ms = entry.utc_ms;
+    return 0;
+}
+
+/*
+Function : trace_writer_close
+
+Description :
+    Appends the index and footer, then flushes and closes a trace file.
+
+Parameter :
+    struct trace_writer *writer - Writer
+
+Return :
+    int - 0 on success, -1 if the file could not be written completely
+
+Example Call :
+    trace_writer_close(&writer);
+*/
+int trace_writer_close(struct trace_writer *writer)
+{
+    struct trace_footer footer = {
+        .index_offset = writer->bytes,
+        .index_count = writer->epochs,
+        .entry_size = sizeof(struct trace_index_entry),
+        .magic = TRACE_INDEX_MAGIC,
+    };
+    uint8_t buffer[64 * 1024];
+    size_t n;
+    int err = 0;
+
+    /* Records are padded, so the index that follows them is aligned. */
+    rewind(writer->index);
+    while ((n = fread(buffer, 1, sizeof(buffer), writer->index)) > 0)
+    {
+        if (fwrite(buffer, 1, n, writer->file) != n)
+        {
+            err = -1;
+            break;
+        }
+    }
+
+    if (ferror(writer->index) || fwrite(&footer, sizeof(footer), 1, writer->file) != 1)
+    {
+        err = -1;
+    }
+
+    fclose(writer->index);
+    if (fclose(writer->file) != 0)
+    {
+        err = -1;
+    }
+
+    writer->index = NULL;
+    writer->file = NULL;
+    return err;
+}
+
+/*
+Function : index_scan
+
+Description :
+    Builds the index of a trace without footer by walking its records. A
+    truncated last record ends the trace.
+
+Parameter :
+    struct trace_reader *reader - Reader with base, size and records_end set
+
+Return :
+    int - 0 on success, -1 if out of memory
+
+Example Call :
+    index_scan(reader);
+*/
+static int index_scan(struct trace_reader *reader)
+{
+    size_t capacity = 0;
+    size_t offset = 0;
+    size_t record_offset;
+    const struct trace_record_header *record;
+
+    for (;;)
+    {
+        record_offset = offset != 0 ? offset : sizeof(struct trace_file_header);
+        record = trace_record_next(reader, &offset);
+        if (record == NULL)
+        {
+            break;
+        }
+
+        if (record->type != TRACE_RECORD_EPOCH || record->length < sizeof(struct trace_epoch))
+        {
+            continue;
+        }
+
+        if (reader->epochs == capacity)
+        {
+            struct trace_index_entry *index;
+
+            capacity = capacity != 0 ? capacity * 2 : 4096;
+            index = realloc(reader->scanned_index, capacity * sizeof(*index));
+            if (index == NULL)
+            {
+                return -1;
+            }
+            reader->scanned_index = index;
+        }
+
+        index_entry_set(&reader->scanned_index[reader->epochs],
+                        reader->epochs > 0 ? &reader->scanned_index[reader->epochs - 1] : NULL,
+                        (const struct trace_epoch *)(record + 1), record_offset);
+        reader->epochs++;
+    }
+
+    reader->index = reader->scanned_index;
+    return 0;
+}
+
+/*
+Function : trace_reader_open
+
+Description :
+    Maps a trace file and locates its index, or builds one if the trace has no
+    footer.
+
+Parameter :
+    struct trace_reader *reader - Reader
+    const char *path            - Trace path
+
+Return :
+    int - 0 on success, -1 on failure
+
+Example Call :
+    if (trace_reader_open(&reader, "drive.trace") != 0) { ... }
+*/
+int trace_reader_open(struct trace_reader *reader, const char *path)
+{
+    const struct trace_file_header *header;
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    memset(reader, 0, sizeof(*reader));
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(*header))
+    {
+        close(fd);
+        return -1;
+    }
+
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    reader->base = base;
+    reader->size = (size_t)st.st_size;
+    reader->records_end = reader->size;
+
+    header = (const struct trace_file_header *)reader->base;
+    if (memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != TRACE_VERSION)
+    {
+        trace_reader_close(reader);
+        return -1;
+    }
+
+    if (reader->size >= sizeof(*header) + sizeof(struct trace_footer))
+    {
+        const struct trace_footer *footer =
+            (const struct trace_footer *)(reader->base + reader->size - sizeof(*footer));
+        uint64_t index_end = reader->size - sizeof(*footer);
+
+        if (memcmp(footer->magic, TRACE_INDEX_MAGIC, sizeof(footer->magic)) == 0 &&
+            footer->entry_size == sizeof(struct trace_index_entry) &&
+            footer->index_offset >= sizeof(*header) && footer->index_offset <= index_end &&
+            footer->index_offset % TRACE_ALIGN == 0 &&
+            footer->index_count == (index_end - footer->index_offset) / footer->entry_size)
+        {
+            reader->index = (const struct trace_index_entry *)(reader->base +
+                                                               footer->index_offset);
+            reader->epochs = footer->index_count;
+            reader->records_end = footer->index_offset;
+            return 0;
+        }
+    }
+
+    if (index_scan(reader) != 0)
+    {
+        trace_reader_close(reader);
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+Function : trace_reader_close
+
+Description :
+    Unmaps a trace file.
+
+Parameter :
+    struct trace_reader *reader - Reader
+
+Return :
+    void
+
+Example Call :
+    trace_reader_close(&reader);
+*/
+void trace_reader_close(struct trace_reader *reader)
+{
+    if (reader->base != NULL)
+    {
+        munmap((void *)reader->base, reader->size);
+    }
+
+    free(reader->scanned_index);
+    memset(reader, 0, sizeof(*reader));
+}
+
+/*
+Function : trace_epoch_get
+
+Description :
+    Returns an epoch by number through the index. The footer index is not
+    trusted: the entry must point to an aligned epoch record within the
+    records.
+
+Parameter :
+    const struct trace_reader *reader - Reader
+    uint64_t n                        - Epoch number, from 0
+
+Return :
+    const struct trace_epoch * - Epoch in the mapped file, NULL if out of range
+                                 or the index entry is corrupt
+
+Example Call :
+    const struct trace_epoch *epoch = trace_epoch_get(&reader, 1000);
+*/
+const struct trace_epoch *trace_epoch_get(const struct trace_reader *reader, uint64_t n)
+{
+    const struct trace_record_header *record;
+    uint64_t offset;
+
+    if (n >= reader->epochs)
+    {
+        return NULL;
+    }
+
+    offset = reader->index[n].offset;
+    if (offset < sizeof(struct trace_file_header) || offset % TRACE_ALIGN != 0 ||
+        offset > reader->records_end ||
+        reader->records_end - offset <
+            sizeof(struct trace_record_header) + sizeof(struct trace_epoch))
+    {
+        return NULL;
+    }
+
+    record = (const struct trace_record_header *)(reader->base + offset);
+    if (record->type != TRACE_RECORD_EPOCH || record->length < sizeof(struct trace_epoch))
+    {
+        return NULL;
+    }
+
+    return (const struct trace_epoch *)(record + 1);
+}
+
+/*
+Function : trace_epoch_find_utc
+
+Description :
+    Finds the first epoch at or after a time with a binary search on the index.
+
+Parameter :
+    const struct trace_reader *reader - Reader
+    int64_t utc_ms                    - UTC time, Unix milliseconds
+
+Return :
+    int64_t - Epoch number, -1 if the trace ends before the time
+
+Example Call :
+    int64_t n = trace_epoch_find_utc(&reader, incident_ms);
+*/
+int64_t trace_epoch_find_utc(const struct trace_reader *reader, int64_t utc_ms)
+{
+    uint64_t low = 0;
+    uint64_t high = reader->epochs;
+
+    while (low < high)
+    {
+        uint64_t mid = low + (high - low) / 2;
+
+        if (reader->index[mid].utc_ms < utc_ms)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low < reader->epochs ? (int64_t)low : -1;
+}
+
+/*
+Function : trace_record_next
+
+Description :
+    Returns the record at an offset and advances the offset past it, to walk
+    the records that follow an epoch (e.g. its NMEA sentences).
+
+Parameter :
+    const struct trace_reader *reader - Reader
+    size_t *offset                    - Record offset, 0 for the first record
+
+Return :
+    const struct trace_record_header * - Record, payload follows the header,
+                                         NULL at the end of the records
+
+Example Call :
+    size_t offset = reader.index[n].offset;
+    const struct trace_record_header *record = trace_record_next(&reader, &offset);
+*/
+const struct trace_record_header *trace_record_next(const struct trace_reader *reader,
+                                                    size_t *offset)
+{
+    const struct trace_record_header *record;
+    size_t at = *offset != 0 ? *offset : sizeof(struct trace_file_header);
+    size_t padded;
+
+    if (at + sizeof(*record) > reader->records_end)
+    {
+        return NULL;
+    }
+
+    record = (const struct trace_record_header *)(reader->base + at);
+    padded = (record->length + TRACE_ALIGN - 1) / TRACE_ALIGN * TRACE_ALIGN;
+    if (at + sizeof(*record) + padded > reader->records_end)
+    {
+        return NULL;
+    }
+
+    *offset = at + sizeof(*record) + padded;
+    return record;
+}
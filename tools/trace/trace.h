@@ -0,0 +1,164 @@
+/*
+Name : trace.h
+
+Description :
+    Header file for the binary GNSS trace format used by the host replay tools.
+    A trace is a file header followed by records, each a record header and a
+    payload padded to TRACE_ALIGN bytes, so payloads stay aligned when the
+    file is mapped, and a footer index. All values are little-endian.
+
+        trace_file_header
+        trace_record_header, payload (trace_epoch, NMEA text, ...)
+        ...
+        trace_index_entry for every epoch record, in order
+        trace_footer
+
+    The index maps epoch numbers and fix times to record offsets, so a mapped
+    trace is accessed at any epoch or time without reading the records before
+    it. Readers skip record types they do not know; a trace without footer
+    (e.g. an interrupted conversion) is indexed by scanning it once.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#ifndef _TRACE_H
+#define _TRACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_MAGIC "GNSSTRC"
+#define TRACE_INDEX_MAGIC "GNSSIDX"
+#define TRACE_VERSION 1
+#define TRACE_ALIGN 8
+
+/* Same bits as NRF_MODEM_GNSS_PVT_FLAG_*. */
+#define TRACE_FLAG_FIX_VALID 0x01
+#define TRACE_FLAG_LEAP_SECOND_VALID 0x02
+#define TRACE_FLAG_SLEEP_BETWEEN_PVT 0x04
+#define TRACE_FLAG_DEADLINE_MISSED 0x08
+#define TRACE_FLAG_NOT_ENOUGH_WINDOW_TIME 0x10
+#define TRACE_FLAG_VELOCITY_VALID 0x20
+#define TRACE_FLAG_SCHED_DOWNLOAD 0x40
+
+enum trace_record_type
+{
+    TRACE_RECORD_EPOCH = 1,
+    TRACE_RECORD_NMEA = 2,
+};
+
+struct trace_file_header
+{
+    char magic[8];
+    uint16_t version;
+    uint16_t header_size;
+    uint32_t reserved;
+};
+
+struct trace_record_header
+{
+    uint16_t type;
+    uint16_t length; /* Payload bytes, without padding */
+    uint32_t reserved;
+};
+
+/* One PVT notification. Fix fields are zero unless TRACE_FLAG_FIX_VALID is set. */
+struct trace_epoch
+{
+    int64_t uptime_ms; /* Device uptime, -1 if unknown */
+    int64_t utc_ms;    /* Fix time, Unix milliseconds */
+    double latitude;
+    double longitude;
+    float accuracy;
+    float altitude;
+    float altitude_accuracy;
+    float speed;
+    float speed_accuracy;
+    float vertical_speed;
+    float vertical_speed_accuracy;
+    float heading;
+    float heading_accuracy;
+    float pdop;
+    float hdop;
+    float vdop;
+    float tdop;
+    uint8_t flags; /* TRACE_FLAG_* */
+    uint8_t tracked;
+    uint8_t in_fix;
+    uint8_t unhealthy;
+    uint8_t confidence;
+    uint8_t reserved[3];
+};
+
+/* Index entry of an epoch record. utc_ms is the fix time, or for epochs
+ * without a fix the last fix time advanced by uptime (0 before the first fix),
+ * and never decreases, so it can be searched. */
+struct trace_index_entry
+{
+    uint64_t offset;
+    int64_t uptime_ms;
+    int64_t utc_ms;
+};
+
+struct trace_footer
+{
+    uint64_t index_offset;
+    uint64_t index_count;
+    uint32_t entry_size;
+    uint32_t reserved;
+    char magic[8];
+};
+
+_Static_assert(sizeof(struct trace_file_header) == 16, "trace file header layout");
+_Static_assert(sizeof(struct trace_record_header) == 8, "trace record header layout");
+_Static_assert(sizeof(struct trace_epoch) == 96, "trace epoch layout");
+_Static_assert(sizeof(struct trace_index_entry) == 24, "trace index entry layout");
+_Static_assert(sizeof(struct trace_footer) == 32, "trace footer layout");
+
+struct trace_writer
+{
+    FILE *file;
+    /* Index entries are staged in a temporary file, memory use stays constant. */
+    FILE *index;
+    uint64_t records;
+    uint64_t epochs;
+    uint64_t bytes;
+    int64_t last_utc_ms;
+    int64_t last_uptime_ms;
+};
+
+/* Mapped trace. */
+struct trace_reader
+{
+    const uint8_t *base;
+    size_t size;
+    size_t records_end;
+    const struct trace_index_entry *index;
+    uint64_t epochs;
+    /* Index built by scanning, for traces without footer. */
+    struct trace_index_entry *scanned_index;
+};
+
+int trace_writer_open(struct trace_writer *writer, const char *path);
+
+int trace_write(struct trace_writer *writer, uint16_t type, const void *payload,
+                uint16_t length);
+
+int trace_write_epoch(struct trace_writer *writer, const struct trace_epoch *epoch);
+
+int trace_writer_close(struct trace_writer *writer);
+
+int trace_reader_open(struct trace_reader *reader, const char *path);
+
+void trace_reader_close(struct trace_reader *reader);
+
+const struct trace_epoch *trace_epoch_get(const struct trace_reader *reader, uint64_t n);
+
+int64_t trace_epoch_find_utc(const struct trace_reader *reader, int64_t utc_ms);
+
+const struct trace_record_header *trace_record_next(const struct trace_reader *reader,
+                                                    size_t *offset);
+
+#endif
@@ -0,0 +1,164 @@
+/*
+Name : trace_dump.c
+
+Description :
+    Prints epochs of a binary trace (tools/trace) as CSV, starting at an epoch
+    number or at a UTC time. The trace is mapped and the start found through
+    its footer index, so seeking to an incident in a day-long recording takes
+    microseconds regardless of where it is. The time to open and seek is
+    printed to stderr.
+
+    Build and run:
+        cc -O2 -I../trace -I../../components/gnss_time trace_dump.c ../trace/trace.c \
+            ../../components/gnss_time/gnss_time.c -o trace_dump
+        ./trace_dump <trace file> [-n epoch | -t YYYY-MM-DDThh:mm:ss] [-c count]
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gnss_time.h"
+#include "trace.h"
+
+#define DEFAULT_COUNT 10
+
+static double elapsed_us(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_nsec - start->tv_nsec) / 1e3;
+}
+
+static int parse_utc(const char *s, int64_t *utc_ms)
+{
+    unsigned int year, month, day, hour, minute, seconds;
+
+    if (sscanf(s, "%u-%u-%uT%u:%u:%u", &year, &month, &day, &hour, &minute, &seconds) != 6)
+    {
+        return -1;
+    }
+
+    *utc_ms = gnss_time_utc_ms((uint16_t)year, (uint8_t)month, (uint8_t)day, (uint8_t)hour,
+                               (uint8_t)minute, (uint8_t)seconds, 0);
+    return 0;
+}
+
+static void print_epoch(uint64_t n, const struct trace_index_entry *entry,
+                        const struct trace_epoch *e)
+{
+    /* Fix time, or the index time (advanced by uptime) without a fix. */
+    int64_t utc_ms = (e->flags & TRACE_FLAG_FIX_VALID) ? e->utc_ms : entry->utc_ms;
+    time_t seconds = (time_t)(utc_ms / 1000);
+    struct tm tm;
+    char utc[80] = "";
+
+    if (utc_ms > 0 && gmtime_r(&seconds, &tm) != NULL)
+    {
+        snprintf(utc, sizeof(utc), "%04d-%02d-%02dT%02d:%02d:%02d.%03d", tm.tm_year + 1900,
+                 tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+                 (int)(utc_ms % 1000));
+    }
+
+    printf("%llu,%lld,%s,0x%02x,%u,%u", (unsigned long long)n, (long long)e->uptime_ms, utc,
+           e->flags, e->tracked, e->in_fix);
+
+    if (e->flags & TRACE_FLAG_FIX_VALID)
+    {
+        printf(",%.6f,%.6f,%.1f,%.1f,%.1f,%.1f,%u\n", e->latitude, e->longitude,
+               (double)e->accuracy, (double)e->altitude, (double)e->speed, (double)e->heading,
+               e->confidence);
+    }
+    else
+    {
+        printf(",,,,,,,\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    struct trace_reader reader;
+    struct timespec start;
+    int64_t first = 0;
+    int64_t utc_ms = 0;
+    uint64_t count = DEFAULT_COUNT;
+    int by_time = 0;
+
+    if (argc < 2 || argc % 2 != 0)
+    {
+        fprintf(stderr, "usage: %s <trace file> [-n epoch | -t YYYY-MM-DDThh:mm:ss] [-c count]\n",
+                argv[0]);
+        return 1;
+    }
+
+    for (int i = 2; i < argc; i += 2)
+    {
+        if (strcmp(argv[i], "-n") == 0)
+        {
+            first = strtoll(argv[i + 1], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-t") == 0 && parse_utc(argv[i + 1], &utc_ms) == 0)
+        {
+            by_time = 1;
+        }
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            count = strtoull(argv[i + 1], NULL, 10);
+        }
+        else
+        {
+            fprintf(stderr, "invalid option %s %s\n", argv[i], argv[i + 1]);
+            return 1;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    if (trace_reader_open(&reader, argv[1]) != 0)
+    {
+        fprintf(stderr, "%s: cannot open or not a trace\n", argv[1]);
+        return 1;
+    }
+
+    if (by_time)
+    {
+        first = trace_epoch_find_utc(&reader, utc_ms);
+    }
+
+    fprintf(stderr, "%llu epochs (%s), open and seek %.0f us\n",
+            (unsigned long long)reader.epochs,
+            reader.scanned_index != NULL ? "no index, scanned" : "indexed", elapsed_us(&start));
+
+    if (first < 0 || (uint64_t)first >= reader.epochs)
+    {
+        fprintf(stderr, "no epoch at the requested position\n");
+        trace_reader_close(&reader);
+        return 1;
+    }
+
+    printf("epoch,uptime_ms,utc,flags,tracked,in_fix,latitude,longitude,accuracy,altitude,"
+           "speed,heading,confidence\n");
+
+    for (uint64_t n = (uint64_t)first; n < reader.epochs && n < (uint64_t)first + count; n++)
+    {
+        const struct trace_epoch *epoch = trace_epoch_get(&reader, n);
+
+        if (epoch == NULL)
+        {
+            fprintf(stderr, "corrupt index entry of epoch %llu\n", (unsigned long long)n);
+            trace_reader_close(&reader);
+            return 1;
+        }
+
+        print_epoch(n, &reader.index[n], epoch);
+    }
+
+    trace_reader_close(&reader);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+Name : trig_bench.c
+
+Description :
+    Host benchmark for components/fast_trig. Measures the maximum absolute error
+    of each function against libm double precision and the time per call of
+    libm double, libm float and fast_trig over the geodesy input range.
+
+    Build and run:
+        cc -O2 -I../../components/fast_trig trig_bench.c \
+            ../../components/fast_trig/fast_trig.c -lm -o trig_bench
+        ./trig_bench
+
+    The same comparison runs on target with CONFIG_GNSS_SAMPLE_TRIG_BENCHMARK=y.
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "fast_trig.h"
+
+#define SAMPLES 4096
+#define ROUNDS 2000
+
+static float angles[SAMPLES];
+static float unit[SAMPLES];
+static float coords[SAMPLES][2];
+
+static volatile float sink_f;
+static volatile double sink_d;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+#define BENCH(label, type, sink, expr)                                  \
+    do                                                                  \
+    {                                                                   \
+        double start = now_ns();                                        \
+        for (int r = 0; r < ROUNDS; r++)                                \
+        {                                                               \
+            type acc = 0;                                               \
+            for (int i = 0; i < SAMPLES; i++)                           \
+            {                                                           \
+                acc += (expr);                                          \
+            }                                                           \
+            sink = acc;                                                 \
+        }                                                               \
+        printf("  %-22s %7.2f ns/call\n", label,                        \
+               (now_ns() - start) / ((double)ROUNDS * SAMPLES));         \
+    } while (0)
+
+int main(void)
+{
+    srand(1);
+
+    for (int i = 0; i < SAMPLES; i++)
+    {
+        angles[i] = (float)((rand() / (double)RAND_MAX * 2.0 - 1.0) * 2.0 * M_PI);
+        unit[i] = (float)(rand() / (double)RAND_MAX * 2.0 - 1.0);
+        coords[i][0] = (float)(rand() / (double)RAND_MAX * 2.0 - 1.0);
+        coords[i][1] = (float)(rand() / (double)RAND_MAX * 2.0 - 1.0);
+    }
+
+    /* Error over a dense sweep rather than the random samples. */
+    double err_sin = 0, err_cos = 0, err_asin = 0, err_atan = 0;
+
+    for (int i = 0; i <= 1000000; i++)
+    {
+        float x = (float)(-8.0 * M_PI + 16.0 * M_PI * i / 1000000.0);
+        float u = (float)(-1.0 + 2.0 * i / 1000000.0);
+        float a = (float)(2.0 * M_PI * i / 1000000.0);
+        float y = sinf(a) * 3.0f;
+        float xx = cosf(a) * 3.0f;
+
+        err_sin = fmax(err_sin, fabs(fast_sinf(x) - sin(x)));
+        err_cos = fmax(err_cos, fabs(fast_cosf(x) - cos(x)));
+        err_asin = fmax(err_asin, fabs(fast_asinf(u) - asin(u)));
+        err_atan = fmax(err_atan, fabs(fast_atan2f(y, xx) - atan2(y, xx)));
+    }
+
+    printf("Max absolute error vs libm double\n");
+    printf("  fast_sinf   %.3g (bound %.3g)\n", err_sin, FAST_TRIG_SIN_MAX_ERROR);
+    printf("  fast_cosf   %.3g (bound %.3g)\n", err_cos, FAST_TRIG_SIN_MAX_ERROR);
+    printf("  fast_asinf  %.3g (bound %.3g)\n", err_asin, FAST_TRIG_ASIN_MAX_ERROR);
+    printf("  fast_atan2f %.3g (bound %.3g)\n", err_atan, FAST_TRIG_ATAN_MAX_ERROR);
+
+    printf("Time per call\n");
+    BENCH("sin (double)", double, sink_d, sin(angles[i]));
+    BENCH("sinf", float, sink_f, sinf(angles[i]));
+    BENCH("fast_sinf", float, sink_f, fast_sinf(angles[i]));
+    BENCH("asin (double)", double, sink_d, asin(unit[i]));
+    BENCH("asinf", float, sink_f, asinf(unit[i]));
+    BENCH("fast_asinf", float, sink_f, fast_asinf(unit[i]));
+    BENCH("atan2 (double)", double, sink_d, atan2(coords[i][0], coords[i][1]));
+    BENCH("atan2f", float, sink_f, atan2f(coords[i][0], coords[i][1]));
+    BENCH("fast_atan2f", float, sink_f, fast_atan2f(coords[i][0], coords[i][1]));
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+/*
+Name : ttff_replay.c
+
+Description :
+    Host replay harness for components/ttff_model. Replays recorded
+    acquisitions through the model in order, predicting each TTFF before the
+    model learns it, and reports the prediction error and, for a range of
+    scheduling margins, how many fix deadlines would be missed and how early
+    the fixes would arrive, compared to starting GNSS a fixed time ahead.
+
+    Input is a device log with "TTFF record: since_fix_s,eph_valid,sv_used,
+    ttff_ms" lines (logged in scheduled mode) or a file with the same values as
+    plain CSV. Without an input file a synthetic trace is generated.
+
+    Build and run:
+        cc -O2 -I../../components/ttff_model ttff_replay.c \
+            ../../components/ttff_model/ttff_model.c -lm -o ttff_replay
+        ./ttff_replay [log file]
+
+Developer : Engr Akbar Shah
+
+Date : October 18, 2026
+*/
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ttff_model.h"
+
+#define MAX_RECORDS 100000
+#define MIN_SV 5
+#define FIXED_LEAD_MS 60000
+#define SYNTHETIC_RECORDS 5000
+#define SYNTHETIC_INTERVAL_S 600
+
+struct record
+{
+    struct ttff_features features;
+    uint32_t ttff_ms;
+};
+
+static struct record records[MAX_RECORDS];
+
+static const float margins[] = {0.0f, 1.0f, 2.0f, 3.0f};
+
+static int load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int n = 0;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (n < MAX_RECORDS && fgets(line, sizeof(line), f) != NULL)
+    {
+        const char *p = strstr(line, "TTFF record:");
+        unsigned since, eph, sv, ttff;
+
+        p = p != NULL ? p + strlen("TTFF record:") : line;
+        if (sscanf(p, "%u,%u,%u,%u", &since, &eph, &sv, &ttff) != 4)
+        {
+            continue;
+        }
+
+        records[n].features.since_fix_s = since;
+        records[n].features.eph_valid = (uint8_t)eph;
+        records[n].features.sv_used = (uint8_t)sv;
+        records[n].ttff_ms = ttff;
+        n++;
+    }
+
+    fclose(f);
+    return n;
+}
+
+static double uniform(void)
+{
+    return (rand() + 0.5) / ((double)RAND_MAX + 1.0);
+}
+
+/* Log-normal TTFF around a median, with the given spread (sigma of ln). */
+static uint32_t draw_ttff(double median_ms, double sigma)
+{
+    double z = sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform());
+
+    return (uint32_t)(median_ms * exp(sigma * z));
+}
+
+/* Scheduled fixes with ephemerides expiring every 2 hours and the device
+ * moving between open sky and obstructed places. */
+static int synthesize(void)
+{
+    int obstructed = 0;
+    uint32_t since_refresh = 0;
+
+    srand(1);
+
+    for (int n = 0; n < SYNTHETIC_RECORDS; n++)
+    {
+        struct record *r = &records[n];
+
+        if (uniform() < 0.05)
+        {
+            obstructed = !obstructed;
+        }
+
+        since_refresh += SYNTHETIC_INTERVAL_S;
+        int eph = since_refresh < 7200 ? 8 - (int)(since_refresh / 1800) : 0;
+
+        r->features.since_fix_s = n == 0 ? TTFF_NO_FIX : SYNTHETIC_INTERVAL_S;
+        r->features.eph_valid = (uint8_t)(n == 0 ? 0 : eph);
+        r->features.sv_used = (uint8_t)(obstructed ? 4 + rand() % 3 : 7 + rand() % 5);
+
+        if (n == 0)
+        {
+            r->ttff_ms = draw_ttff(obstructed ? 80000 : 40000, 0.3);
+        }
+        else if (eph >= MIN_SV)
+        {
+            r->ttff_ms = draw_ttff(obstructed ? 4000 : 1500, 0.5);
+        }
+        else
+        {
+            r->ttff_ms = draw_ttff(obstructed ? 55000 : 30000, 0.3);
+            since_refresh = 0;
+        }
+    }
+
+    return SYNTHETIC_RECORDS;
+}
+
+int main(int argc, char **argv)
+{
+    int n = argc > 1 ? load(argv[1]) : synthesize();
+
+    if (n <= 0)
+    {
+        fprintf(stderr, "No TTFF records\n");
+        return 1;
+    }
+
+    printf("%d acquisitions (%s)\n\n", n, argc > 1 ? argv[1] : "synthetic");
+    printf("%-14s %10s %10s %12s %14s\n", "scheduler", "MAE ms", "missed", "miss rate", "mean early ms");
+
+    for (size_t m = 0; m <= sizeof(margins) / sizeof(margins[0]); m++)
+    {
+        bool fixed = m == sizeof(margins) / sizeof(margins[0]);
+        struct ttff_model model;
+        double abs_error = 0.0;
+        double early = 0.0;
+        int missed = 0;
+
+        ttff_model_init(&model, MIN_SV);
+
+        for (int i = 0; i < n; i++)
+        {
+            uint32_t lead = fixed ? FIXED_LEAD_MS
+                                  : ttff_model_predict(&model, &records[i].features, margins[m]);
+            uint32_t mean = ttff_model_predict(&model, &records[i].features, 0.0f);
+
+            abs_error += fabs((double)mean - records[i].ttff_ms);
+
+            if (records[i].ttff_ms > lead)
+            {
+                missed++;
+            }
+            else
+            {
+                early += lead - records[i].ttff_ms;
+            }
+
+            ttff_model_update(&model, &records[i].features, records[i].ttff_ms);
+        }
+
+        char label[32];
+
+        if (fixed)
+        {
+            snprintf(label, sizeof(label), "fixed %u s", FIXED_LEAD_MS / 1000);
+        }
+        else
+        {
+            snprintf(label, sizeof(label), "model +%.0f dev", (double)margins[m]);
+        }
+
+        char mae[16] = "-";
+
+        if (!fixed)
+        {
+            snprintf(mae, sizeof(mae), "%.0f", abs_error / n);
+        }
+
+        printf("%-14s %10s %10d %11.1f%% %14.0f\n", label, mae, missed, 100.0 * missed / n,
+               n > missed ? early / (n - missed) : 0.0);
+    }
+
+    return 0;
+}